@@ -75,4 +75,6 @@ with __build_extension_env():
     from _PyPartMC import __all__ as _PyPartMC_all  # pylint: disable=no-name-in-module
     from _PyPartMC import __version__, __versions_of_build_time_dependencies__
 
-    __all__ = tuple([*_PyPartMC_all, "si"])
+    __all__ = tuple([*_PyPartMC_all, "si", "EnsembleRunner"])
+
+from .ensemble import EnsembleRunner
@@ -0,0 +1,116 @@
+"""
+Runner for ensembles of independent `run_part` replicates
+"""
+
+import multiprocessing
+import os
+from concurrent.futures import ProcessPoolExecutor
+
+
+def _run_replicate(ctor_args, seed, index):
+    # pylint: disable=import-outside-toplevel
+    import PyPartMC as ppmc
+
+    aero_data = ppmc.AeroData(ctor_args["aero_data"])
+    gas_data = ppmc.GasData(ctor_args["gas_data"])
+    gas_state = ppmc.GasState(gas_data)
+    scenario = ppmc.Scenario(gas_data, aero_data, ctor_args["scenario"])
+    env_state = ppmc.EnvState(ctor_args["env_state"])
+    scenario.init_env_state(env_state, 0.0)
+
+    run_part_opt_ctor_arg = {**ctor_args["run_part_opt"], "rand_init": seed}
+    if "output_prefix" in run_part_opt_ctor_arg:
+        run_part_opt_ctor_arg["output_prefix"] += f"_{index:04d}"
+    run_part_opt = ppmc.RunPartOpt(run_part_opt_ctor_arg)
+
+    aero_state = ppmc.AeroState(aero_data, *ctor_args["aero_state"])
+    if ctor_args["aero_dist"] is not None:
+        aero_state.dist_sample(
+            ppmc.AeroDist(aero_data, ctor_args["aero_dist"]),
+            sample_prop=1.0,
+            create_time=0.0,
+            allow_doubling=run_part_opt_ctor_arg.get("allow_doubling", True),
+            allow_halving=run_part_opt_ctor_arg.get("allow_halving", True),
+        )
+
+    ppmc.run_part(
+        scenario,
+        env_state,
+        aero_data,
+        aero_state,
+        gas_data,
+        gas_state,
+        run_part_opt,
+        ppmc.CampCore(),
+        ppmc.Photolysis(),
+    )
+
+    return {
+        "seed": seed,
+        "aero_state": aero_state.to_arrays(),
+        "gas_mix_rats": gas_state.mix_rats,
+        "env_state": {
+            "elapsed_time": env_state.elapsed_time,
+            "temp": env_state.temp,
+            "rh": env_state.rh,
+            "pressure": env_state.pressure,
+            "height": env_state.height,
+        },
+    }
+
+
+class EnsembleRunner:  # pylint: disable=too-few-public-methods
+    """Runs independent `run_part` replicates (one per seed) on a fixed-size pool
+    of worker processes and collects the final states in memory.
+
+    PartMC keeps its random number generator, particle ID counter and other
+    simulation state in Fortran module variables, hence each replicate is run in
+    a separate process (started with the "spawn" method) rather than a thread,
+    which gives every worker its own RNG stream seeded through `rand_init`.
+    All arguments but `n_workers` are the JSON-compatible constructor arguments
+    of the respective PyPartMC classes (`aero_state` being the tuple of
+    `AeroState` constructor arguments following `aero_data`); if `aero_dist` is
+    given, the initial population is sampled from it. If `run_part_opt` sets
+    `output_prefix`, the replicate index is appended to it.
+    """
+
+    def __init__(
+        self,
+        *,
+        aero_data,
+        gas_data,
+        scenario,
+        env_state,
+        aero_state,
+        run_part_opt,
+        aero_dist=None,
+        n_workers=None,
+    ):
+        self.ctor_args = {
+            "aero_data": aero_data,
+            "gas_data": gas_data,
+            "scenario": scenario,
+            "env_state": env_state,
+            "aero_state": tuple(aero_state),
+            "aero_dist": aero_dist,
+            "run_part_opt": run_part_opt,
+        }
+        if run_part_opt.get("do_parallel", False):
+            raise ValueError("setting do_parallel=true not supported in PyPartMC")
+        self.n_workers = n_workers or os.cpu_count()
+
+    def run(self, seeds):
+        """returns a list (ordered as `seeds`) of dicts with the seed, the final
+        `AeroState.to_arrays()` export, gas mixing ratios and environment state"""
+        seeds = list(seeds)
+        if any(seed == 0 for seed in seeds):
+            raise ValueError("seeds must be non-zero (0 means a time-based seed)")
+        with ProcessPoolExecutor(
+            max_workers=min(self.n_workers, max(len(seeds), 1)),
+            mp_context=multiprocessing.get_context("spawn"),
+        ) as executor:
+            futures = [
+                executor.submit(_run_replicate, self.ctor_args, seed, index)
+                for index, seed in enumerate(seeds)
+            ]
+            return [future.result() for future in futures]
@@ -0,0 +1,211 @@
+####################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+####################################################################################################
+
+# throughput benchmarks (pytest-benchmark), to be run with, e.g.:
+#   pytest benchmarks --benchmark-only --benchmark-json=benchmarks.json
+# besides timings, the entries of benchmarks processing particles (all but the JSON
+# spec parsing ones) carry "particles_per_second" and "ns_per_particle_step" in their
+# "extra_info" field
+
+import numpy as np
+import pytest
+
+import PyPartMC as ppmc
+from tests.common import (
+    AERO_DATA_CTOR_ARG_FULL,
+    AERO_DIST_CTOR_ARG_COAGULATION,
+    ENV_STATE_CTOR_ARG_HIGH_RH,
+    ENV_STATE_CTOR_ARG_MINIMAL,
+    GAS_DATA_CTOR_ARG_MINIMAL,
+    RUN_PART_OPT_CTOR_ARG_SIMULATION,
+    SCENARIO_CTOR_ARG_SIMULATION,
+)
+
+N_PARTS = (1000, 10000)
+N_STEPS = 10
+ROUNDS = 3
+
+
+def report_throughput(benchmark, n_part, n_steps=1):
+    mean = benchmark.stats.stats.mean
+    benchmark.extra_info["n_part"] = n_part
+    benchmark.extra_info["n_steps"] = n_steps
+    benchmark.extra_info["particles_per_second"] = n_part * n_steps / mean
+    benchmark.extra_info["ns_per_particle_step"] = mean / n_part / n_steps * 1e9
+
+
+class ParticleCounts:
+    """tracks the actual numbers of particles (which differ from the nominal n_part
+    passed to AeroState) before and after each benchmarked round"""
+
+    def __init__(self):
+        self.rounds = []
+
+    def track(self, aero_state):
+        self.rounds.append((aero_state, len(aero_state)))
+        return aero_state
+
+    def mean(self, before=True):
+        return np.mean(
+            [
+                (n_before + len(aero_state)) / 2 if before else len(aero_state)
+                for aero_state, n_before in self.rounds
+            ]
+        )
+
+
+def make_aero_state(aero_data, n_part):
+    aero_state = ppmc.AeroState(aero_data, n_part, "nummass_source")
+    aero_state.dist_sample(
+        ppmc.AeroDist(aero_data, AERO_DIST_CTOR_ARG_COAGULATION),
+        1.0,
+        0.0,
+        False,
+        False,
+    )
+    return aero_state
+
+
+def make_run_part_args(coag_kernel, n_part):
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    gas_data = ppmc.GasData(GAS_DATA_CTOR_ARG_MINIMAL)
+    scenario = ppmc.Scenario(gas_data, aero_data, SCENARIO_CTOR_ARG_SIMULATION)
+    env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_MINIMAL)
+    scenario.init_env_state(env_state, 0.0)
+    if coag_kernel == "additive":
+        env_state.additive_kernel_coefficient = 1000
+    del_t = RUN_PART_OPT_CTOR_ARG_SIMULATION["del_t"]
+    run_part_opt = ppmc.RunPartOpt(
+        {
+            **RUN_PART_OPT_CTOR_ARG_SIMULATION,
+            "coag_kernel": coag_kernel,
+            "t_max": N_STEPS * del_t,
+            "t_output": 0,
+        }
+    )
+    return (
+        scenario,
+        env_state,
+        aero_data,
+        make_aero_state(aero_data, n_part),
+        gas_data,
+        ppmc.GasState(gas_data),
+        run_part_opt,
+        ppmc.CampCore(),
+        ppmc.Photolysis(),
+    )
+
+
+@pytest.fixture(autouse=True)
+def rand_init():
+    ppmc.rand_init(44)
+
+
+@pytest.mark.parametrize("n_part", N_PARTS)
+@pytest.mark.parametrize("coag_kernel", ("brown", "sedi", "additive"))
+def test_run_part(benchmark, coag_kernel, n_part):
+    counts = ParticleCounts()
+
+    def setup():
+        args = make_run_part_args(coag_kernel, n_part)
+        counts.track(args[3])
+        return args, {}
+
+    benchmark.pedantic(ppmc.run_part, setup=setup, rounds=ROUNDS)
+    report_throughput(benchmark, counts.mean(), N_STEPS)
+
+
+@pytest.mark.parametrize("n_part", N_PARTS)
+def test_condense_equilib_particles(benchmark, n_part):
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_HIGH_RH)
+    env_state.set_temperature(300)
+
+    counts = ParticleCounts()
+
+    benchmark.pedantic(
+        ppmc.condense_equilib_particles,
+        setup=lambda: (
+            (env_state, aero_data, counts.track(make_aero_state(aero_data, n_part))),
+            {},
+        ),
+        rounds=ROUNDS,
+    )
+    report_throughput(benchmark, counts.mean())
+
+
+@pytest.mark.parametrize("n_part", N_PARTS)
+def test_dist_sample(benchmark, n_part):
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    aero_dist = ppmc.AeroDist(aero_data, AERO_DIST_CTOR_ARG_COAGULATION)
+
+    counts = ParticleCounts()
+
+    benchmark.pedantic(
+        lambda aero_state: aero_state.dist_sample(aero_dist, 1.0, 0.0, False, False),
+        setup=lambda: (
+            (counts.track(ppmc.AeroState(aero_data, n_part, "nummass_source")),),
+            {},
+        ),
+        rounds=ROUNDS,
+    )
+    report_throughput(benchmark, counts.mean(before=False))
+
+
+@pytest.mark.parametrize("n_part", (10000, 1000000))
+def test_histogram_1d(benchmark, n_part):
+    grid = ppmc.BinGrid(100, "log", 1e-9, 1e-5)
+    vals = 10 ** np.random.uniform(-9, -5, n_part)
+    weights = np.ones(n_part)
+
+    benchmark(ppmc.histogram_1d, grid, vals, weights)
+    report_throughput(benchmark, n_part)
+
+
+@pytest.mark.parametrize("n_part", (10000, 1000000))
+def test_histogram_2d(benchmark, n_part):
+    x_grid = ppmc.BinGrid(100, "log", 1e-9, 1e-5)
+    y_grid = ppmc.BinGrid(50, "linear", 0, 1)
+    x_vals = 10 ** np.random.uniform(-9, -5, n_part)
+    y_vals = np.random.random(n_part)
+    weights = np.ones(n_part)
+
+    benchmark(ppmc.histogram_2d, x_grid, x_vals, y_grid, y_vals, weights)
+    report_throughput(benchmark, n_part)
+
+
+@pytest.mark.parametrize(
+    "ctor",
+    (
+        lambda: ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL),
+        lambda: ppmc.RunPartOpt(RUN_PART_OPT_CTOR_ARG_SIMULATION),
+        lambda: ppmc.Scenario(
+            ppmc.GasData(GAS_DATA_CTOR_ARG_MINIMAL),
+            ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL),
+            SCENARIO_CTOR_ARG_SIMULATION,
+        ),
+    ),
+    ids=("AeroData", "RunPartOpt", "Scenario"),
+)
+def test_spec_json_parsing(benchmark, ctor):
+    benchmark(ctor)
+
+
+@pytest.mark.parametrize("n_part", N_PARTS)
+def test_output_input_state(benchmark, tmp_path, n_part):
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    aero_state = make_aero_state(aero_data, n_part)
+    gas_data = ppmc.GasData(GAS_DATA_CTOR_ARG_MINIMAL)
+    gas_state = ppmc.GasState(gas_data)
+    env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_MINIMAL)
+    prefix = str(tmp_path / "bench")
+
+    def round_trip():
+        ppmc.output_state(prefix, aero_data, aero_state, gas_data, gas_state, env_state)
+        return ppmc.input_state(prefix + "_0001_00000001.nc")
+
+    benchmark(round_trip)
+    report_throughput(benchmark, len(aero_state))
@@ -154,6 +154,10 @@ setup(
             "ghapi",
             "scipy",
         ],
+        "benchmarks": [
+            "pytest",
+            "pytest-benchmark",
+        ],
         "examples": [
             "matplotlib!=3.10.0",
             "ipywidgets",
@@ -12,7 +12,10 @@
 #include "aero_particle.hpp"
 #include "env_state.hpp"
 #include "bin_grid.hpp"
+#include "species_selector.hpp"
+#include "pmc_lock.hpp"
 #include "pybind11/stl.h"
+#include "pybind11/numpy.h"
 #include "tl/optional.hpp"
 
 extern "C" void f_aero_state_ctor(
@@ -128,6 +131,53 @@ extern "C" void f_aero_state_mixing_state_metrics(
     void *group
 ) noexcept;
 
+extern "C" void f_aero_state_masses_selected(
+    const void *ptr,
+    const void *aero_dataptr,
+    double *masses,
+    const int *n_parts,
+    const int *n_spec,
+    const int *mask
+) noexcept;
+
+extern "C" void f_aero_state_volumes_selected(
+    const void *ptr,
+    double *volumes,
+    const int *n_parts,
+    const int *n_spec,
+    const int *mask
+) noexcept;
+
+extern "C" void f_aero_state_diameters_selected(
+    const void *ptr,
+    const void *aero_dataptr,
+    double *diameters,
+    const int *n_parts,
+    const int *n_spec,
+    const int *mask
+) noexcept;
+
+extern "C" void f_aero_state_mixing_state_metrics_selected(
+    const void *aero_state,
+    const void *aero_data,
+    double *d_alpha,
+    double *d_gamma,
+    double *chi,
+    const int *n_spec,
+    const int *mask,
+    const int *group_mask
+) noexcept;
+
+extern "C" void f_aero_state_diagnostics(
+    const void *ptr,
+    const void *aero_dataptr,
+    const int *n_parts,
+    const int *n_quantities,
+    const int *quantities,
+    double *values,
+    const void *env_stateptr
+) noexcept;
+
 extern "C" void f_aero_state_bin_average_comp(
     const void *ptr_c,
     const void *bin_grid_ptr, 
@@ -182,6 +232,40 @@ extern "C" void f_aero_state_ids(
     const int *n_parts
 ) noexcept;
 
+extern "C" void f_aero_state_to_arrays(
+    const void *ptr_c,
+    const void *aero_data_ptr,
+    const int *n_parts,
+    const int *n_spec,
+    const int *n_source,
+    double *volumes,
+    double *num_concs,
+    int *weight_groups,
+    int *weight_classes,
+    int64_t *ids,
+    double *least_create_times,
+    double *greatest_create_times,
+    int *sources
+) noexcept;
+
+extern "C" void f_aero_state_n_weight(
+    const void *ptr,
+    int *n_group,
+    int *n_class
+) noexcept;
+
+extern "C" void f_aero_state_add_particles_from_arrays(
+    void *ptr_c,
+    const void *aero_data_ptr,
+    const int *n_parts,
+    const int *n_spec,
+    const double *volumes,
+    const int *weight_groups,
+    const int *weight_classes,
+    const double *create_times,
+    const int *sources
+) noexcept;
+
 extern "C" void f_aero_state_add(
      void *ptr_c,
      const void *delta_ptr_c,
@@ -220,6 +304,21 @@ auto pointer_vec_magic(arr_t &data_vec, const arg_t &arg) {
     return pointer_vec;
 }
 
+template <typename T>
+auto output_array(const pybind11::object &out, const int len) {
+    using array_t = pybind11::array_t<T, pybind11::array::c_style>;
+    if (out.is_none())
+        return array_t(len);
+    if (!pybind11::isinstance<array_t>(out))
+        throw std::invalid_argument("out must be a C-contiguous array of matching dtype");
+    auto array = pybind11::reinterpret_borrow<array_t>(out);
+    if (array.ndim() != 1 || array.shape(0) != len)
+        throw std::invalid_argument("out must be a 1D array of length equal to the number of particles");
+    if (!array.writeable())
+        throw std::invalid_argument("out must be writeable");
+    return array;
+}
+
 
 struct AeroState {
     PMCResource ptr;
@@ -298,18 +397,20 @@ struct AeroState {
         return total_mass_conc;
     }
 
+    // num_concs, dry_diameters and ids are exposed as read-only properties, which cannot
+    // take an out= argument; changing them to methods would break the existing API
     static auto num_concs(const AeroState &self) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> num_concs(len);
+        auto num_concs = output_array<double>(pybind11::none(), len);
 
         f_aero_state_num_concs(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
-            begin(num_concs),
+            num_concs.mutable_data(),
             &len
         );
 
@@ -319,14 +420,15 @@ struct AeroState {
     static auto masses(
         const AeroState &self,
         const tl::optional<std::valarray<std::string>> &include,
-        const tl::optional<std::valarray<std::string>> &exclude
+        const tl::optional<std::valarray<std::string>> &exclude,
+        const pybind11::object &out
     ) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> masses(len);
+        auto masses = output_array<double>(out, len);
 
         const int include_size = (include.has_value()) ? include.value().size() : 0;
         const int exclude_size = (exclude.has_value()) ? exclude.value().size() : 0;
@@ -338,7 +440,7 @@ struct AeroState {
         f_aero_state_masses(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
-            begin(masses),
+            masses.mutable_data(),
             &len,
             &include_size,
             &exclude_size,
@@ -349,37 +451,75 @@ struct AeroState {
         return masses;
     }
 
+    static void check_selector(
+        const AeroState &self,
+        const SpeciesSelector &selector
+    ) {
+        if (selector.aero_data != self.aero_data)
+            throw std::invalid_argument("SpeciesSelector built for a different AeroData");
+    }
+
+    static auto masses_selected(
+        const AeroState &self,
+        const SpeciesSelector &selector,
+        const pybind11::object &out
+    ) {
+        check_selector(self, selector);
+        int len;
+        f_aero_state_len(
+            self.ptr.f_arg(),
+            &len
+        );
+        auto masses = output_array<double>(out, len);
+        const int n_spec = selector.mask.size();
+
+        f_aero_state_masses_selected(
+            self.ptr.f_arg(),
+            self.aero_data->ptr.f_arg(),
+            masses.mutable_data(),
+            &len,
+            &n_spec,
+            selector.mask.data()
+        );
+
+        return masses;
+    }
+
     static auto dry_diameters(const AeroState &self) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> dry_diameters(len);
+        auto dry_diameters = output_array<double>(pybind11::none(), len);
 
         f_aero_state_dry_diameters(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
-            begin(dry_diameters),
+            dry_diameters.mutable_data(),
             &len
         );
 
         return dry_diameters;
     }
 
-    static auto mobility_diameters(const AeroState &self, const EnvState &env_state) {
+    static auto mobility_diameters(
+        const AeroState &self,
+        const EnvState &env_state,
+        const pybind11::object &out
+    ) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> mobility_diameters(len);
+        auto mobility_diameters = output_array<double>(out, len);
 
         f_aero_state_mobility_diameters(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
             env_state.ptr.f_arg(),
-            begin(mobility_diameters),
+            mobility_diameters.mutable_data(),
             &len
         );
 
@@ -389,14 +529,15 @@ struct AeroState {
     static auto diameters(
         const AeroState &self,
         const tl::optional<std::valarray<std::string>> &include,
-        const tl::optional<std::valarray<std::string>> &exclude
+        const tl::optional<std::valarray<std::string>> &exclude,
+        const pybind11::object &out
     ) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> diameters(len);
+        auto diameters = output_array<double>(out, len);
 
         const int include_size = (include.has_value()) ? include.value().size() : 0;
         const int exclude_size = (exclude.has_value()) ? exclude.value().size() : 0;
@@ -408,7 +549,7 @@ struct AeroState {
         f_aero_state_diameters(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
-            begin(diameters),
+            diameters.mutable_data(),
             &len,
             &include_size,
             &exclude_size,
@@ -419,17 +560,44 @@ struct AeroState {
         return diameters;
     }
 
+    static auto diameters_selected(
+        const AeroState &self,
+        const SpeciesSelector &selector,
+        const pybind11::object &out
+    ) {
+        check_selector(self, selector);
+        int len;
+        f_aero_state_len(
+            self.ptr.f_arg(),
+            &len
+        );
+        auto diameters = output_array<double>(out, len);
+        const int n_spec = selector.mask.size();
+
+        f_aero_state_diameters_selected(
+            self.ptr.f_arg(),
+            self.aero_data->ptr.f_arg(),
+            diameters.mutable_data(),
+            &len,
+            &n_spec,
+            selector.mask.data()
+        );
+
+        return diameters;
+    }
+
     static auto volumes(
         const AeroState &self,
         const tl::optional<std::valarray<std::string>> &include,
-        const tl::optional<std::valarray<std::string>> &exclude
+        const tl::optional<std::valarray<std::string>> &exclude,
+        const pybind11::object &out
     ) {
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> volumes(len);
+        auto volumes = output_array<double>(out, len);
 
         const int include_size = (include.has_value()) ? include.value().size() : 0;
         const int exclude_size = (exclude.has_value()) ? exclude.value().size() : 0;
@@ -441,7 +609,7 @@ struct AeroState {
         f_aero_state_volumes(
             self.ptr.f_arg(),
             self.aero_data->ptr.f_arg(),
-            begin(volumes),
+            volumes.mutable_data(),
             &len,
             &include_size,
             &exclude_size,
@@ -452,24 +620,54 @@ struct AeroState {
         return volumes;
     }
 
-    static auto crit_rel_humids(
+    static auto volumes_selected(
         const AeroState &self,
-        const EnvState &env_state
+        const SpeciesSelector &selector,
+        const pybind11::object &out
     ) {
+        check_selector(self, selector);
         int len;
         f_aero_state_len(
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<double> crit_rel_humids(len);
+        auto volumes = output_array<double>(out, len);
+        const int n_spec = selector.mask.size();
 
-        f_aero_state_crit_rel_humids(
+        f_aero_state_volumes_selected(
+            self.ptr.f_arg(),
+            volumes.mutable_data(),
+            &len,
+            &n_spec,
+            selector.mask.data()
+        );
+
+        return volumes;
+    }
+
+    static auto crit_rel_humids(
+        const AeroState &self,
+        const EnvState &env_state,
+        const pybind11::object &out
+    ) {
+        int len;
+        f_aero_state_len(
             self.ptr.f_arg(),
-            self.aero_data->ptr.f_arg(),
-            env_state.ptr.f_arg(), 
-            begin(crit_rel_humids),
             &len
         );
+        auto crit_rel_humids = output_array<double>(out, len);
+        auto data = crit_rel_humids.mutable_data();
+
+        {
+            pybind11::gil_scoped_release release;
+            f_aero_state_crit_rel_humids(
+                self.ptr.f_arg(),
+                self.aero_data->ptr.f_arg(),
+                env_state.ptr.f_arg(),
+                data,
+                &len
+            );
+        }
 
         return crit_rel_humids;
     }
@@ -489,17 +687,68 @@ struct AeroState {
             self.ptr.f_arg(),
             &len
         );
-        std::valarray<int64_t> ids(len);
+        auto ids = output_array<int64_t>(pybind11::none(), len);
 
         f_aero_state_ids(
             self.ptr.f_arg(),
-            begin(ids),
+            ids.mutable_data(),
             &len
         );
 
         return ids;
     }
 
+    static auto to_arrays(const AeroState &self) {
+        int len;
+        f_aero_state_len(
+            self.ptr.f_arg(),
+            &len
+        );
+        const int n_spec = AeroData::__len__(*self.aero_data);
+        int n_source;
+        f_aero_data_n_source(
+            self.aero_data->ptr.f_arg(),
+            &n_source
+        );
+        n_source = std::max(n_source, 0);
+
+        auto volumes = pybind11::array_t<double>({len, n_spec});
+        auto num_concs = pybind11::array_t<double>(len);
+        auto weight_groups = pybind11::array_t<int>(len);
+        auto weight_classes = pybind11::array_t<int>(len);
+        auto ids = pybind11::array_t<int64_t>(len);
+        auto least_create_times = pybind11::array_t<double>(len);
+        auto greatest_create_times = pybind11::array_t<double>(len);
+        auto sources = pybind11::array_t<int>({len, n_source});
+
+        f_aero_state_to_arrays(
+            self.ptr.f_arg(),
+            self.aero_data->ptr.f_arg(),
+            &len,
+            &n_spec,
+            &n_source,
+            volumes.mutable_data(),
+            num_concs.mutable_data(),
+            weight_groups.mutable_data(),
+            weight_classes.mutable_data(),
+            ids.mutable_data(),
+            least_create_times.mutable_data(),
+            greatest_create_times.mutable_data(),
+            sources.mutable_data()
+        );
+
+        pybind11::dict arrays;
+        arrays["volumes"] = volumes;
+        arrays["num_concs"] = num_concs;
+        arrays["weight_groups"] = weight_groups;
+        arrays["weight_classes"] = weight_classes;
+        arrays["ids"] = ids;
+        arrays["least_create_times"] = least_create_times;
+        arrays["greatest_create_times"] = greatest_create_times;
+        arrays["sources"] = sources;
+        return arrays;
+    }
+
     static auto mixing_state(
         const AeroState &self,
         const tl::optional<std::valarray<std::string>> &include,
@@ -541,6 +790,94 @@ struct AeroState {
         return std::make_tuple(d_alpha, d_gamma, chi); 
     }
 
+    static auto mixing_state_selected(
+        const AeroState &self,
+        const SpeciesSelector &selector,
+        const tl::optional<std::valarray<std::string>> &group
+    ) {
+        check_selector(self, selector);
+        double chi;
+        double d_alpha;
+        double d_gamma;
+
+        const int n_spec = selector.mask.size();
+        std::vector<int> group_mask(n_spec, 0);
+        if (group.has_value())
+            for (const auto &name : group.value())
+                group_mask[AeroData::spec_by_name(*self.aero_data, name)] = 1;
+
+        f_aero_state_mixing_state_metrics_selected(
+            self.ptr.f_arg(),
+            self.aero_data->ptr.f_arg(),
+            &d_alpha,
+            &d_gamma,
+            &chi,
+            &n_spec,
+            selector.mask.data(),
+            group_mask.data()
+        );
+
+        return std::make_tuple(d_alpha, d_gamma, chi);
+    }
+
+    static auto diagnostics(
+        const AeroState &self,
+        const std::vector<std::string> &quantities,
+        const EnvState *env_state
+    ) {
+        // codes as in f_aero_state_diagnostics()
+        static const std::map<std::string, int> quantity_codes{
+            {"num_concs", 1},
+            {"masses", 2},
+            {"volumes", 3},
+            {"diameters", 4},
+            {"dry_diameters", 5},
+            {"mobility_diameters", 6},
+            {"crit_rel_humids", 7},
+        };
+
+        std::vector<int> codes;
+        for (const auto &quantity : quantities) {
+            if (quantity_codes.find(quantity) == quantity_codes.end()) {
+                std::ostringstream msg;
+                msg << "unknown quantity '" << quantity << "', valid options are: ";
+                auto index = 0;
+                for (auto const& pair: quantity_codes)
+                    msg << (!index++ ? "" : ", ") << pair.first;
+                throw std::invalid_argument(msg.str());
+            }
+            if ((quantity == "mobility_diameters" || quantity == "crit_rel_humids") && !env_state)
+                throw std::invalid_argument("env_state is required for " + quantity);
+            codes.push_back(quantity_codes.at(quantity));
+        }
+
+        int len;
+        f_aero_state_len(
+            self.ptr.f_arg(),
+            &len
+        );
+        const int n_quantities = codes.size();
+        auto values = pybind11::array_t<double>({n_quantities, len});
+
+        {
+            pybind11::gil_scoped_release release;
+            f_aero_state_diagnostics(
+                self.ptr.f_arg(),
+                self.aero_data->ptr.f_arg(),
+                &len,
+                &n_quantities,
+                codes.data(),
+                values.mutable_data(),
+                env_state ? env_state->ptr.f_arg() : nullptr
+            );
+        }
+
+        pybind11::dict result;
+        for (int i = 0; i < n_quantities; ++i)
+            result[pybind11::str(quantities[i])] = pybind11::object(values[pybind11::int_(i)]);
+        return result;
+    }
+
     static void bin_average_comp(
         AeroState &self,
         const BinGrid &bin_grid
@@ -575,6 +912,7 @@ struct AeroState {
         std::valarray<double> data(len);
 
         AeroParticle *ptr = new AeroParticle(self.aero_data, data);
+        PMCLock lock;
         f_aero_state_rand_particle(self.ptr.f_arg(), ptr);
 
         return ptr;
@@ -599,6 +937,7 @@ struct AeroState {
        self.allow_doubling = allow_doubling;
        self.allow_halving = allow_halving;
 
+       PMCLock lock;
        f_aero_state_add_aero_dist_sample(
            self.ptr.f_arg(),
            self.aero_data->ptr.f_arg(),
@@ -624,6 +963,65 @@ struct AeroState {
 
    } 
 
+   static void add_particles_from_arrays(
+       AeroState &self,
+       const pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast> &volumes,
+       const tl::optional<std::vector<int>> &weight_groups,
+       const tl::optional<std::vector<int>> &weight_classes,
+       const tl::optional<std::vector<double>> &create_times,
+       const tl::optional<std::vector<int>> &sources
+   ) {
+       const int n_spec = AeroData::__len__(*self.aero_data);
+       if (volumes.ndim() != 2 || volumes.shape(1) != n_spec)
+           throw std::invalid_argument("volumes must be a 2D array of shape (n_part, n_spec)");
+       const int n_part = volumes.shape(0);
+
+       auto column = [n_part](const auto &arg, const char *name, auto fill) {
+           if (!arg.has_value())
+               return std::vector<decltype(fill)>(n_part, fill);
+           if ((int)arg.value().size() != n_part) {
+               std::ostringstream msg;
+               msg << name << " must be of length equal to the number of rows of volumes";
+               throw std::invalid_argument(msg.str());
+           }
+           return arg.value();
+       };
+       const auto weight_groups_vec = column(weight_groups, "weight_groups", 0);
+       const auto weight_classes_vec = column(weight_classes, "weight_classes", 0);
+       const auto create_times_vec = column(create_times, "create_times", 0.);
+       const auto sources_vec = column(sources, "sources", -1);
+
+       int n_group, n_class;
+       f_aero_state_n_weight(self.ptr.f_arg(), &n_group, &n_class);
+       for (const auto group : weight_groups_vec)
+           if (group < 0 || group >= n_group)
+               throw std::out_of_range("weight group index out of range");
+       for (const auto weight_class : weight_classes_vec)
+           if (weight_class < 0 || weight_class >= n_class)
+               throw std::out_of_range("weight class index out of range");
+
+       if (sources.has_value()) {
+           const int n_source = AeroData::n_source(*self.aero_data);
+           for (const auto source : sources_vec)
+               if (source < 0 || source >= n_source)
+                   throw std::out_of_range("source index out of range");
+       }
+
+       pybind11::gil_scoped_release release;
+       PMCLock lock;
+       f_aero_state_add_particles_from_arrays(
+           self.ptr.f_arg_non_const(),
+           self.aero_data->ptr.f_arg(),
+           &n_part,
+           &n_spec,
+           volumes.data(),
+           weight_groups_vec.data(),
+           weight_classes_vec.data(),
+           create_times_vec.data(),
+           sources_vec.data()
+       );
+   }
+
    static void copy_weight(
       AeroState &self,
       const AeroState &aero_state_from
@@ -672,6 +1070,7 @@ struct AeroState {
        AeroState &aero_state_sample,
        const double sample_prob
    )  {
+        PMCLock lock;
         f_aero_state_sample(self.ptr.f_arg_non_const(),
             aero_state_sample.ptr.f_arg_non_const(),
             self.aero_data->ptr.f_arg(),
@@ -684,6 +1083,7 @@ struct AeroState {
        AeroState &aero_state_sample,
        const double sample_prob
    )  {
+        PMCLock lock;
         f_aero_state_sample_particles(self.ptr.f_arg_non_const(),
             aero_state_sample.ptr.f_arg_non_const(),
             self.aero_data->ptr.f_arg(),
@@ -0,0 +1,57 @@
+/*##################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+##################################################################################################*/
+
+#include "coag_kernel.hpp"
+#include "json_resource.hpp"
+
+pybind11::array_t<double> coag_kernel(
+    const std::string &kernel_type,
+    const std::vector<const AeroParticle*> &particles_a,
+    const std::vector<const AeroParticle*> &particles_b,
+    const EnvState &env_state
+) {
+    int coag_kernel_type;
+    {
+        JSONResourceGuard<InputJSONResource> guard(nlohmann::json({{"coag_kernel", kernel_type}}));
+        f_coag_kernel_type_from_json(&coag_kernel_type);
+        guard.check_parameters();
+    }
+
+    std::shared_ptr<AeroData> aero_data;
+    auto f_ptrs = [&aero_data](const std::vector<const AeroParticle*> &particles) {
+        std::vector<void*> ptrs;
+        for (const auto particle : particles) {
+            if (!aero_data)
+                aero_data = particle->aero_data;
+            else if (particle->aero_data != aero_data)
+                throw std::invalid_argument("all particles must share the same AeroData");
+            ptrs.push_back(*static_cast<void* const*>(particle->ptr.f_arg()));
+        }
+        return ptrs;
+    };
+    const auto ptrs_a = f_ptrs(particles_a), ptrs_b = f_ptrs(particles_b);
+
+    const int n_a = particles_a.size(), n_b = particles_b.size();
+    auto k = pybind11::array_t<double>({n_a, n_b});
+    if (n_a == 0 || n_b == 0)
+        return k;
+
+    auto k_data = k.mutable_data();
+    {
+        pybind11::gil_scoped_release release;
+        f_coag_kernel(
+            &coag_kernel_type,
+            &n_a,
+            ptrs_a.data(),
+            &n_b,
+            ptrs_b.data(),
+            aero_data->ptr.f_arg(),
+            env_state.ptr.f_arg(),
+            k_data
+        );
+    }
+    return k;
+}
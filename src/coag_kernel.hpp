@@ -0,0 +1,33 @@
+/*##################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+##################################################################################################*/
+
+#pragma once
+#include "aero_particle.hpp"
+#include "env_state.hpp"
+#include "pybind11/numpy.h"
+
+// not noexcept: an unknown kernel name makes PartMC stop (c_stop() throws)
+extern "C" void f_coag_kernel_type_from_json(
+    int*
+);
+
+extern "C" void f_coag_kernel(
+    const int*,
+    const int*,
+    const void*,
+    const int*,
+    const void*,
+    const void*,
+    const void*,
+    double*
+) noexcept;
+
+pybind11::array_t<double> coag_kernel(
+    const std::string &kernel_type,
+    const std::vector<const AeroParticle*> &particles_a,
+    const std::vector<const AeroParticle*> &particles_b,
+    const EnvState &env_state
+);
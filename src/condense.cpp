@@ -4,7 +4,11 @@
 # Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
 ##################################################################################################*/
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
 #include "condense.hpp"
+#include "pmc_lock.hpp"
 
 void condense_equilib_particle(
     const EnvState &env_state,
@@ -21,11 +25,119 @@ void condense_equilib_particle(
 void condense_equilib_particles(
     const EnvState &env_state,
     const AeroData &aero_data,
-    const AeroState &aero_state
+    const AeroState &aero_state,
+    const tl::optional<std::vector<int>> &indices,
+    const int n_threads
 ) {
-    f_condense_equilib_particles(
-        env_state.ptr.f_arg(),
+    if (n_threads < 0)
+        throw std::invalid_argument("n_threads must be non-negative");
+
+    int n_parts;
+    f_aero_state_len(aero_state.ptr.f_arg(), &n_parts);
+
+    std::vector<int> idx;
+    if (indices.has_value()) {
+        idx = indices.value();
+        for (const auto i : idx)
+            if (i < 0 || i >= n_parts)
+                throw std::out_of_range("particle index out of range");
+        // each particle is handled by exactly one thread
+        std::sort(idx.begin(), idx.end());
+        idx.erase(std::unique(idx.begin(), idx.end()), idx.end());
+    } else {
+        idx.resize(n_parts);
+        std::iota(idx.begin(), idx.end(), 0);
+    }
+
+    const int n = idx.size();
+    const int n_workers = std::max(1, std::min(
+        n,
+        n_threads > 0 ? n_threads : static_cast<int>(std::thread::hardware_concurrency())
+    ));
+
+    if (!indices.has_value() && n_workers == 1) {
+        PMCLock lock;
+        f_condense_equilib_particles_all(
+            env_state.ptr.f_arg(),
+            aero_data.ptr.f_arg(),
+            aero_state.ptr.f_arg()
+        );
+        return;
+    }
+
+    // as in PartMC's condense_equilib_particles(), the sort is invalidated and the number
+    // concentrations are recorded before, and the particles are reweighted after the water
+    // uptake; the reweighting draws from the shared RNG, hence both steps are done serially
+    std::vector<double> reweight_num_conc(n_parts);
+    {
+        PMCLock lock;
+        f_condense_equilib_particles_num_conc_for_reweight(
+            aero_data.ptr.f_arg(),
+            aero_state.ptr.f_arg(),
+            &n_parts,
+            reweight_num_conc.data()
+        );
+    }
+
+    // particles are independent given the EnvState, and PartMC's condense_equilib_particle()
+    // uses no module-level state, hence the per-particle part runs without PMCLock
+    const int chunk = (n + n_workers - 1) / n_workers;
+    std::vector<std::exception_ptr> errors(n_workers);
+    // joins the already started workers also if spawning a subsequent one throws
+    struct JoiningThreads : std::vector<std::thread> {
+        ~JoiningThreads() {
+            for (auto &thread : *this)
+                if (thread.joinable())
+                    thread.join();
+        }
+    } threads;
+
+    for (int i_worker = 0; i_worker < n_workers; ++i_worker) {
+        const int begin = i_worker * chunk;
+        const int len = std::min(chunk, n - begin);
+        if (len <= 0)
+            break;
+        threads.emplace_back([&, i_worker, begin, len]() {
+            try {
+                f_condense_equilib_particles(
+                    env_state.ptr.f_arg(),
+                    aero_data.ptr.f_arg(),
+                    aero_state.ptr.f_arg(),
+                    &len,
+                    idx.data() + begin
+                );
+            } catch (...) {
+                errors[i_worker] = std::current_exception();
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    for (const auto &error : errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    PMCLock lock;
+    f_condense_equilib_particles_reweight(
         aero_data.ptr.f_arg(),
-        aero_state.ptr.f_arg()
+        aero_state.ptr.f_arg(),
+        &n_parts,
+        reweight_num_conc.data()
+    );
+}
+
+void condense_particles(
+    AeroState &aero_state,
+    const EnvState &env_state,
+    EnvState &env_state_final,
+    const double del_t
+) {
+    PMCLock lock;
+    f_condense_particles(
+        aero_state.ptr.f_arg_non_const(),
+        aero_state.aero_data->ptr.f_arg(),
+        env_state.ptr.f_arg(),
+        env_state_final.ptr.f_arg_non_const(),
+        &del_t
     );
 }
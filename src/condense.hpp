@@ -9,6 +9,7 @@
 #include "aero_state.hpp"
 #include "env_state.hpp"
 #include "aero_particle.hpp"
+#include "tl/optional.hpp"
 
 extern "C" void f_condense_equilib_particle(
     const void*,
@@ -16,12 +17,43 @@ extern "C" void f_condense_equilib_particle(
     const void*
 ) noexcept;
 
+// not noexcept: PartMC errors (thrown from c_stop()) are caught within the worker threads
 extern "C" void f_condense_equilib_particles(
+    const void*,
+    const void*,
+    const void*,
+    const int*,
+    const int*
+);
+
+extern "C" void f_condense_equilib_particles_all(
     const void*,
     const void*,
     const void*
 ) noexcept;
 
+extern "C" void f_condense_equilib_particles_num_conc_for_reweight(
+    const void*,
+    const void*,
+    const int*,
+    double*
+) noexcept;
+
+extern "C" void f_condense_equilib_particles_reweight(
+    const void*,
+    const void*,
+    const int*,
+    const double*
+) noexcept;
+
+extern "C" void f_condense_particles(
+    void*,
+    const void*,
+    const void*,
+    void*,
+    const double*
+) noexcept;
+
 void condense_equilib_particle(
     const EnvState &env_state,
     const AeroData &aero_data,
@@ -31,5 +63,14 @@ void condense_equilib_particle(
 void condense_equilib_particles(
     const EnvState &env_state,
     const AeroData &aero_data,
-    const AeroState &aero_state
+    const AeroState &aero_state,
+    const tl::optional<std::vector<int>> &indices,
+    const int n_threads
+);
+
+void condense_particles(
+    AeroState &aero_state,
+    const EnvState &env_state,
+    EnvState &env_state_final,
+    const double del_t
 );
@@ -7,13 +7,13 @@
 #include "json_resource.hpp"
 
 template <class X>
-X& singleton()
+X& thread_local_singleton()
 {
-    static X x;
+    thread_local X x;
     return x;
 }
 
 std::unique_ptr<JSONResource> &json_resource_ptr() {
-    return singleton<std::unique_ptr<JSONResource>>();
+    return thread_local_singleton<std::unique_ptr<JSONResource>>();
 }
 
@@ -323,6 +323,7 @@ struct OutputJSONResource: JSONResource {
     }
 };
 
+// per-thread, so that objects can be constructed from JSON concurrently with the GIL released
 std::unique_ptr<JSONResource> &json_resource_ptr();
 
 template <typename T>
@@ -5,6 +5,7 @@
 ##################################################################################################*/
 
 #include "output.hpp"
+#include "pmc_lock.hpp"
 
 void output_state(
     const std::string &prefix,
@@ -29,6 +30,7 @@ void output_state(
     record_removals = false;
     record_optical = false;
 
+    PMCLock lock;
     f_output_state(prefix.c_str(), &prefix_size, aero_data.ptr.f_arg(),
        aero_state.ptr.f_arg(), gas_state.gas_data->ptr.f_arg(),
        gas_state.ptr.f_arg(), env_state.ptr.f_arg(), &index, &time, &del_t,
@@ -48,6 +50,7 @@ std::tuple<std::shared_ptr<AeroData>, AeroState*, std::shared_ptr<GasData>,
     AeroState *aero_state = new AeroState(std::shared_ptr<AeroData>(new AeroData()));
     GasState *gas_state = new GasState(std::shared_ptr<GasData>(new GasData()));
     EnvState *env_state = new EnvState();
+    PMCLock lock;
     f_input_state(name.c_str(), &name_size, &index, &time, &del_t, &i_repeat,
        aero_state->aero_data->ptr.f_arg_non_const(), aero_state->ptr.f_arg_non_const(),
        gas_state->gas_data->ptr.f_arg_non_const(), gas_state->ptr.f_arg_non_const(),
@@ -71,6 +74,7 @@ std::tuple<std::shared_ptr<AeroData>, BinGrid*, AeroBinned*, std::shared_ptr<Gas
     BinGrid *bin_grid = new BinGrid();
     GasState *gas_state = new GasState(std::shared_ptr<GasData>(new GasData()));
     EnvState *env_state = new EnvState();
+    PMCLock lock;
     f_input_sectional(name.c_str(), &name_size, &index, &time, &del_t, bin_grid->ptr.f_arg_non_const(),
        aero_binned->aero_data->ptr.f_arg_non_const(), aero_binned->ptr.f_arg_non_const(),
        gas_state->gas_data->ptr.f_arg_non_const(), gas_state->ptr.f_arg_non_const(),
@@ -93,6 +97,7 @@ std::tuple<std::shared_ptr<AeroData>, BinGrid*, AeroBinned*, std::shared_ptr<Gas
     BinGrid *bin_grid = new BinGrid();
     GasState *gas_state = new GasState(std::shared_ptr<GasData>(new GasData()));
     EnvState *env_state = new EnvState();
+    PMCLock lock;
     f_input_exact(name.c_str(), &name_size, &index, &time, &del_t, bin_grid->ptr.f_arg_non_const(),
        aero_binned->aero_data->ptr.f_arg_non_const(), aero_binned->ptr.f_arg_non_const(),
        gas_state->gas_data->ptr.f_arg_non_const(), gas_state->ptr.f_arg_non_const(),
@@ -0,0 +1,22 @@
+/*##################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+##################################################################################################*/
+
+#pragma once
+#include <mutex>
+
+// PartMC keeps the random number generator, the particle ID counter, the condensation
+// solver data and the netCDF output state in Fortran module variables, hence calls that
+// touch any of these are serialised (GIL is released by the bindings before locking)
+inline std::mutex &pmc_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+struct PMCLock {
+    std::lock_guard<std::mutex> guard;
+
+    PMCLock() : guard(pmc_mutex()) {}
+};
@@ -28,6 +28,7 @@
 #include "gas_data.hpp"
 #include "gas_state.hpp"
 #include "condense.hpp"
+#include "coag_kernel.hpp"
 #include "bin_grid.hpp"
 #include "camp_core.hpp"
 #include "photolysis.hpp"
@@ -49,21 +50,85 @@ PYBIND11_MODULE(_PyPartMC, m) {
         PyPartMC is a Python interface to PartMC.
     )pbdoc";
 
-    m.def("run_part", &run_part, "Do a particle-resolved Monte Carlo simulation.");
-    m.def("run_part_timestep", &run_part_timestep, "Do a single time step");
-    m.def("run_part_timeblock", &run_part_timeblock, "Do a time block");
+    m.def("run_part", &run_part, "Do a particle-resolved Monte Carlo simulation.",
+        py::call_guard<py::gil_scoped_release>());
+
+    py::class_<RunPartStats>(m, "RunPartStats",
+        R"pbdoc(
+            Counters of Monte-Carlo events (numbers of sampled particle pairs,
+            coagulation, emission, dilution and nucleation events) and wall time
+            accumulated over run_part_timestep() and run_part_timeblock() calls
+            to which the instance is passed as the stats argument.
+            Note that PartMC resets its event counters whenever it prints
+            progress info, hence with t_progress > 0 in RunPartOpt the counts
+            of events preceding each progress printout within a call are lost.
+        )pbdoc"
+    )
+        .def(py::init<>())
+        .def_readonly("n_samp", &RunPartStats::n_samp, "number of sampled particle pairs")
+        .def_readonly("n_coag", &RunPartStats::n_coag, "number of coagulation events")
+        .def_readonly("n_emit", &RunPartStats::n_emit, "number of emitted particles")
+        .def_readonly("n_dil_in", &RunPartStats::n_dil_in, "number of diluted-in particles")
+        .def_readonly("n_dil_out", &RunPartStats::n_dil_out, "number of diluted-out particles")
+        .def_readonly("n_nuc", &RunPartStats::n_nuc, "number of nucleated particles")
+        .def_readonly("wall_time", &RunPartStats::wall_time, "wall time (in seconds)")
+    ;
+
+    m.def("run_part_timestep", &run_part_timestep, "Do a single time step",
+        py::arg("scenario"), py::arg("env_state"), py::arg("aero_data"),
+        py::arg("aero_state"), py::arg("gas_data"), py::arg("gas_state"),
+        py::arg("run_part_opt"), py::arg("camp_core"), py::arg("photolysis"),
+        py::arg("i_time"), py::arg("t_start"), py::arg("last_output_time"),
+        py::arg("last_progress_time"), py::arg("i_output"),
+        py::arg("stats") = py::none());
+    m.def("run_part_timeblock", &run_part_timeblock, "Do a time block",
+        py::arg("scenario"), py::arg("env_state"), py::arg("aero_data"),
+        py::arg("aero_state"), py::arg("gas_data"), py::arg("gas_state"),
+        py::arg("run_part_opt"), py::arg("camp_core"), py::arg("photolysis"),
+        py::arg("i_time"), py::arg("i_next"), py::arg("t_start"),
+        py::arg("last_output_time"), py::arg("last_progress_time"), py::arg("i_output"),
+        py::arg("stats") = py::none());
 
     m.def("condense_equilib_particles", &condense_equilib_particles, R"pbdoc(
       Call condense_equilib_particle() on each particle in the aerosol
+      (or on the particles with the given indices only)
       to ensure that every particle has its water content in
-      equilibrium.
-    )pbdoc");
+      equilibrium; particles are split among n_threads threads
+      (n_threads=0 means as many as hardware threads available),
+      while the preceding recording of number concentrations and the
+      subsequent reweighting of particles (as in PartMC's
+      condense_equilib_particles()) are done serially.
+    )pbdoc", py::call_guard<py::gil_scoped_release>(),
+        py::arg("env_state"), py::arg("aero_data"), py::arg("aero_state"),
+        py::arg("indices") = py::none(), py::arg("n_threads") = 0);
     m.def("condense_equilib_particle", &condense_equilib_particle, R"pbdoc(
         Determine the water equilibrium state of a single particle.
     )pbdoc");
-
-    m.def("run_sect", &run_sect, "Do a 1D sectional simulation (Bott 1998 scheme).");
-    m.def("run_exact", &run_exact, "Do an exact solution simulation.");
+    m.def("condense_particles", &condense_particles, R"pbdoc(
+        Do condensation of water onto (and evaporation from) all particles
+        over a time step of length del_t, with the environment linearly
+        interpolated between env_state and env_state_final (the relative
+        humidity of the latter is updated to account for the water exchanged
+        with particles).
+    )pbdoc", py::call_guard<py::gil_scoped_release>(),
+        py::arg("aero_state"), py::arg("env_state"), py::arg("env_state_final"),
+        py::arg("del_t"));
+
+    m.def("coag_kernel", &coag_kernel, R"pbdoc(
+        Evaluate the coagulation kernel of the given type (one of the PartMC
+        coag_kernel spec-file options, e.g.: "brown", "sedi", "additive",
+        "constant", "zero", "brown_free", "brown_cont") for all pairs
+        of particles_a and particles_b (which must share the same AeroData),
+        returning an (len(particles_a), len(particles_b)) array of kernel
+        values (m^3/s).
+    )pbdoc",
+        py::arg("kernel_type"), py::arg("particles_a"), py::arg("particles_b"),
+        py::arg("env_state"));
+
+    m.def("run_sect", &run_sect, "Do a 1D sectional simulation (Bott 1998 scheme).",
+        py::call_guard<py::gil_scoped_release>());
+    m.def("run_exact", &run_exact, "Do an exact solution simulation.",
+        py::call_guard<py::gil_scoped_release>());
 
     py::class_<AeroBinned>(m, "AeroBinned",
         R"pbdoc(
@@ -104,7 +169,7 @@ PYBIND11_MODULE(_PyPartMC, m) {
              same, but without the \c _a suffix.
         )pbdoc"
     )
-        .def(py::init<const nlohmann::json&>())
+        .def(py::init<const nlohmann::json&>(), py::call_guard<py::gil_scoped_release>())
         .def("spec_by_name", AeroData::spec_by_name,
              "Returns the number of the species in AeroData with the given name")
         .def("__len__", AeroData::__len__, "Number of aerosol species")
@@ -136,6 +201,20 @@ PYBIND11_MODULE(_PyPartMC, m) {
             "returns list of aerosol species names")
     ;
 
+    py::class_<SpeciesSelector>(m, "SpeciesSelector",
+        R"pbdoc(
+             A set of aerosol species given by include/exclude lists of species names,
+             resolved once against an AeroData so that it can be reused in calls to
+             AeroState.masses(), volumes(), diameters() and mixing_state().
+        )pbdoc"
+    )
+        .def(py::init<std::shared_ptr<AeroData>, const tl::optional<std::valarray<std::string>>&,
+            const tl::optional<std::valarray<std::string>>&>(),
+            py::arg("aero_data"), py::arg("include") = py::none(), py::arg("exclude") = py::none())
+        .def_property_readonly("species", SpeciesSelector::species,
+            "returns the names of the selected aerosol species")
+    ;
+
     py::class_<AeroParticle>(m, "AeroParticle",
         R"pbdoc(
              Single aerosol particle data structure.
@@ -236,41 +315,79 @@ PYBIND11_MODULE(_PyPartMC, m) {
         .def_property_readonly("total_mass_conc", AeroState::total_mass_conc,
             "returns the total mass concentration of the population")
         .def_property_readonly("num_concs", AeroState::num_concs,
-            "returns the number concentration of each particle in the population")
+            "returns the number concentration of each particle in the population (as a numpy.ndarray)")
         .def("masses", AeroState::masses,
-            "returns the total mass of each particle in the population",
-            py::arg("include") = py::none(), py::arg("exclude") = py::none())
+            "returns the total mass of each particle in the population as a numpy.ndarray (optionally written into out)",
+            py::arg("include") = py::none(), py::arg("exclude") = py::none(),
+            py::arg("out") = py::none())
+        .def("masses", AeroState::masses_selected,
+            "returns the mass of each particle in the population accounting only for the species given by a SpeciesSelector (as a numpy.ndarray)",
+            py::arg("selector"), py::arg("out") = py::none())
         .def("volumes", AeroState::volumes,
-            "returns the volume of each particle in the population",
-             py::arg("include") = py::none(), py::arg("exclude") = py::none())
+            "returns the volume of each particle in the population as a numpy.ndarray (optionally written into out)",
+             py::arg("include") = py::none(), py::arg("exclude") = py::none(),
+             py::arg("out") = py::none())
+        .def("volumes", AeroState::volumes_selected,
+            "returns the volume of each particle in the population accounting only for the species given by a SpeciesSelector (as a numpy.ndarray)",
+            py::arg("selector"), py::arg("out") = py::none())
         .def_property_readonly("dry_diameters", AeroState::dry_diameters,
-            "returns the dry diameter of each particle in the population")
+            "returns the dry diameter of each particle in the population (as a numpy.ndarray)")
         .def("mobility_diameters", AeroState::mobility_diameters,
-            "returns the mobility diameter of each particle in the population")
+            "returns the mobility diameter of each particle in the population as a numpy.ndarray (optionally written into out)",
+            py::arg("env_state"), py::arg("out") = py::none())
         .def("diameters", AeroState::diameters,
-            "returns the diameter of each particle in the population",
-            py::arg("include") = py::none(), py::arg("exclude") = py::none())
+            "returns the diameter of each particle in the population as a numpy.ndarray (optionally written into out)",
+            py::arg("include") = py::none(), py::arg("exclude") = py::none(),
+            py::arg("out") = py::none())
+        .def("diameters", AeroState::diameters_selected,
+            "returns the diameter of each particle in the population accounting only for the species given by a SpeciesSelector (as a numpy.ndarray)",
+            py::arg("selector"), py::arg("out") = py::none())
         .def("crit_rel_humids", AeroState::crit_rel_humids,
-            "returns the critical relative humidity of each particle in the population")
+            "returns the critical relative humidity of each particle in the population as a numpy.ndarray (optionally written into out)",
+            py::arg("env_state"), py::arg("out") = py::none())
         .def("make_dry", AeroState::make_dry,
             "Make all particles dry (water set to zero).")
         .def_property_readonly("ids", AeroState::ids,
-            "returns the IDs of all particles.")
+            "returns the IDs of all particles (as a numpy.ndarray).")
+        .def("to_arrays", AeroState::to_arrays,
+            R"pbdoc(returns a dict of arrays describing all particles in the population:
+            species volumes (particles x species), number concentrations, weight
+            groups and classes, IDs, least and greatest creation times and
+            per-source component counts (particles x sources))pbdoc")
         .def("mixing_state", AeroState::mixing_state,
             "returns the mixing state parameters (d_alpha, d_gamma, chi) of the population",
             py::arg("include") = py::none(), py::arg("exclude") = py::none(),
             py::arg("group") = py::none())
+        .def("mixing_state", AeroState::mixing_state_selected,
+            "returns the mixing state parameters (d_alpha, d_gamma, chi) of the population for the species given by a SpeciesSelector",
+            py::arg("selector"), py::arg("group") = py::none())
+        .def("diagnostics", AeroState::diagnostics,
+            R"pbdoc(returns a dict with the requested per-particle quantities (any of: num_concs,
+            masses, volumes, diameters, dry_diameters, mobility_diameters, crit_rel_humids),
+            all computed in a single pass over the population; env_state is required
+            for mobility_diameters and crit_rel_humids)pbdoc",
+            py::arg("quantities"), py::arg("env_state") = py::none())
         .def("bin_average_comp", AeroState::bin_average_comp,
             "composition-averages population using BinGrid")
         .def("particle", AeroState::get_particle,
             "returns the particle of a given index")
         .def("rand_particle", AeroState::get_random_particle,
-            "returns a random particle from the population")
+            "returns a random particle from the population",
+            py::call_guard<py::gil_scoped_release>())
         .def("dist_sample", AeroState::dist_sample,
             "sample particles for AeroState from an AeroDist",
             py::arg("AeroDist"), py::arg("sample_prop") = 1.0, py::arg("create_time") = 0.0,
-            py::arg("allow_doubling") = true, py::arg("allow_halving") = true)
+            py::arg("allow_doubling") = true, py::arg("allow_halving") = true,
+            py::call_guard<py::gil_scoped_release>())
         .def("add_particle", AeroState::add_particle, "add a particle to an AeroState")
+        .def("add_particles_from_arrays", AeroState::add_particles_from_arrays,
+            R"pbdoc(appends particles given by a (particles x species) array of species volumes,
+            with optional per-particle (0-based) weight groups and classes, creation times
+            and source indices (see to_arrays()); particles get new IDs and the
+            sorting of the population is redone once when next needed)pbdoc",
+            py::arg("volumes"), py::arg("weight_groups") = py::none(),
+            py::arg("weight_classes") = py::none(), py::arg("create_times") = py::none(),
+            py::arg("sources") = py::none())
         .def("add", AeroState::add,
             R"pbdoc(aero_state += aero_state_delta, including combining the
             weights, so the new concentration is the weighted average of the
@@ -281,14 +398,16 @@ PYBIND11_MODULE(_PyPartMC, m) {
         .def("sample", AeroState::sample,
              R"pbdoc(Generates a random sample by removing particles from
              aero_state_from and adding them to aero_state_to, transfering
-             weight as well. This is the equivalent of aero_state_add().)pbdoc")
+             weight as well. This is the equivalent of aero_state_add().)pbdoc",
+             py::call_guard<py::gil_scoped_release>())
         .def("sample_particles", AeroState::sample_particles,
              R"pbdoc(  !> Generates a random sample by removing particles from
              aero_state_from and adding them to aero_state_to, which must be
              already allocated (and should have its weight set).
 
              None of the weights are altered by this sampling, making this the
-             equivalent of aero_state_add_particles().)pbdoc")
+             equivalent of aero_state_add_particles().)pbdoc",
+             py::call_guard<py::gil_scoped_release>())
         .def("copy_weight", AeroState::copy_weight,
              "copy weighting from another AeroState")
         .def("remove_particle", AeroState::remove_particle,
@@ -329,7 +448,7 @@ PYBIND11_MODULE(_PyPartMC, m) {
             scenario_t.
         )pbdoc"
     )
-        .def(py::init<const nlohmann::json&>())
+        .def(py::init<const nlohmann::json&>(), py::call_guard<py::gil_scoped_release>())
         .def("set_temperature", EnvState::set_temperature,
             "sets the temperature of the environment state")
         .def_property_readonly("temp", EnvState::temp,
@@ -449,7 +568,7 @@ PYBIND11_MODULE(_PyPartMC, m) {
         "RunPartOpt",
         "Options controlling the execution of run_part()."
     )
-        .def(py::init<const nlohmann::json&>())
+        .def(py::init<const nlohmann::json&>(), py::call_guard<py::gil_scoped_release>())
         .def_property_readonly("t_max", RunPartOpt::t_max, "total simulation time")
         .def_property_readonly("del_t", RunPartOpt::del_t, "time step")
     ;
@@ -562,27 +681,33 @@ PYBIND11_MODULE(_PyPartMC, m) {
     );
 
     m.def(
-        "output_state", &output_state, "Output current state to netCDF file."
+        "output_state", &output_state, "Output current state to netCDF file.",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.def(
-        "input_state", &input_state, "Read current state from run_part netCDF output file."
+        "input_state", &input_state, "Read current state from run_part netCDF output file.",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.def(
-        "input_sectional", &input_sectional, "Read current state from run_sect netCDF output file."
+        "input_sectional", &input_sectional, "Read current state from run_sect netCDF output file.",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.def(
-        "input_exact", &input_exact, "Read current state from run_exact netCDF output file."
+        "input_exact", &input_exact, "Read current state from run_exact netCDF output file.",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.def(
-        "rand_init", &rand_init, "Initializes the random number generator to the state defined by the given seed. If the seed is 0 then a seed is auto-generated from the current time"
+        "rand_init", &rand_init, "Initializes the random number generator to the state defined by the given seed. If the seed is 0 then a seed is auto-generated from the current time",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.def(
-        "rand_normal", &rand_normal, "Generates a normally distributed random number with the given mean and standard deviation"
+        "rand_normal", &rand_normal, "Generates a normally distributed random number with the given mean and standard deviation",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
@@ -612,10 +737,14 @@ PYBIND11_MODULE(_PyPartMC, m) {
         "GasState",
         "Photolysis",
         "RunPartOpt",
+        "RunPartStats",
         "RunSectOpt",
         "RunExactOpt",
         "Scenario",
+        "SpeciesSelector",
         "condense_equilib_particles",
+        "condense_particles",
+        "coag_kernel",
         "run_part",
         "run_part_timeblock",
         "run_part_timestep",
@@ -5,13 +5,16 @@
 ##################################################################################################*/
 
 #include "rand.hpp"
+#include "pmc_lock.hpp"
 
 void rand_init(int seed) {
+  PMCLock lock;
   f_pmc_srand(&seed);
 }
 
 double rand_normal(double mean, double stddev) {
   double val;
+  PMCLock lock;
 
   f_rand_normal(&mean, &stddev, &val);
 
@@ -6,6 +6,7 @@
 
 #include "run_exact.hpp"
 #include "pybind11/stl.h"
+#include "pmc_lock.hpp"
 
 void run_exact(
     const BinGrid &bin_grid,
@@ -16,6 +17,7 @@ void run_exact(
     const EnvState &env_state,
     const RunExactOpt &run_exact_opt
 ) {
+    PMCLock lock;
     f_run_exact(
         bin_grid.ptr.f_arg(),
         gas_data.ptr.f_arg(),
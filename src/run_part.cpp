@@ -4,8 +4,10 @@
 # Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
 ##################################################################################################*/
 
+#include <chrono>
 #include "run_part.hpp"
 #include "pybind11/stl.h"
+#include "pmc_lock.hpp"
 
 void check_allow_flags(
     const AeroState &aero_state,
@@ -30,6 +32,7 @@ void run_part(
     const Photolysis &photolysis
 ) {
     check_allow_flags(aero_state, run_part_opt);
+    PMCLock lock;
     f_run_part(
         scenario.ptr.f_arg(),
         env_state.ptr.f_arg_non_const(),
@@ -57,26 +60,39 @@ std::tuple<double, double, int> run_part_timestep(
     const double &t_start,
     double &last_output_time,
     double &last_progress_time,
-    int &i_output
+    int &i_output,
+    RunPartStats *stats
 ) {
     check_allow_flags(aero_state, run_part_opt);
-    f_run_part_timestep(
-        scenario.ptr.f_arg(),
-        env_state.ptr.f_arg_non_const(),
-        aero_data.ptr.f_arg(),
-        aero_state.ptr.f_arg_non_const(),
-        gas_data.ptr.f_arg(),
-        gas_state.ptr.f_arg_non_const(),
-        run_part_opt.ptr.f_arg(),
-        camp_core.ptr.f_arg(),
-        photolysis.ptr.f_arg(),
-        &i_time,
-        &t_start,
-        &last_output_time,
-        &last_progress_time,
-        &i_output
-    );
+    int progress_counts[6];
+    double wall_time;
+    {
+        pybind11::gil_scoped_release release;
+        PMCLock lock;
+        const auto start = std::chrono::steady_clock::now();
+        f_run_part_timestep(
+            scenario.ptr.f_arg(),
+            env_state.ptr.f_arg_non_const(),
+            aero_data.ptr.f_arg(),
+            aero_state.ptr.f_arg_non_const(),
+            gas_data.ptr.f_arg(),
+            gas_state.ptr.f_arg_non_const(),
+            run_part_opt.ptr.f_arg(),
+            camp_core.ptr.f_arg(),
+            photolysis.ptr.f_arg(),
+            &i_time,
+            &t_start,
+            &last_output_time,
+            &last_progress_time,
+            &i_output,
+            progress_counts
+        );
+        wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
 
+    // stats is a Python-owned object, hence updated only with the GIL held
+    if (stats)
+        stats->add(progress_counts, wall_time);
     return std::make_tuple(last_output_time, last_progress_time, i_output);
 }
 
@@ -95,26 +111,39 @@ std::tuple<double, double, int> run_part_timeblock(
     const double &t_start,
     double &last_output_time,
     double &last_progress_time,
-    int &i_output
+    int &i_output,
+    RunPartStats *stats
 ) {
     check_allow_flags(aero_state, run_part_opt);
-    f_run_part_timeblock(
-        scenario.ptr.f_arg(),
-        env_state.ptr.f_arg_non_const(),
-        aero_data.ptr.f_arg(),
-        aero_state.ptr.f_arg_non_const(),
-        gas_data.ptr.f_arg(),
-        gas_state.ptr.f_arg_non_const(),
-        run_part_opt.ptr.f_arg(),
-        camp_core.ptr.f_arg(),
-        photolysis.ptr.f_arg(),
-        &i_time,
-        &i_next,
-        &t_start,
-        &last_output_time,
-        &last_progress_time,
-        &i_output
-    );
+    int progress_counts[6];
+    double wall_time;
+    {
+        pybind11::gil_scoped_release release;
+        PMCLock lock;
+        const auto start = std::chrono::steady_clock::now();
+        f_run_part_timeblock(
+            scenario.ptr.f_arg(),
+            env_state.ptr.f_arg_non_const(),
+            aero_data.ptr.f_arg(),
+            aero_state.ptr.f_arg_non_const(),
+            gas_data.ptr.f_arg(),
+            gas_state.ptr.f_arg_non_const(),
+            run_part_opt.ptr.f_arg(),
+            camp_core.ptr.f_arg(),
+            photolysis.ptr.f_arg(),
+            &i_time,
+            &i_next,
+            &t_start,
+            &last_output_time,
+            &last_progress_time,
+            &i_output,
+            progress_counts
+        );
+        wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
 
+    // stats is a Python-owned object, hence updated only with the GIL held
+    if (stats)
+        stats->add(progress_counts, wall_time);
     return std::make_tuple(last_output_time, last_progress_time, i_output);
 }
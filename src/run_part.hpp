@@ -5,6 +5,7 @@
 ##################################################################################################*/
 
 #pragma once
+#include <cstdint>
 #include "aero_data.hpp"
 #include "aero_state.hpp"
 #include "env_state.hpp"
@@ -41,6 +42,7 @@ extern "C" void f_run_part_timestep(
     const double*,
     double*,
     double*,
+    int*,
     int*
 ) noexcept;
 
@@ -59,9 +61,28 @@ extern "C" void f_run_part_timeblock(
     const double *,
     double*,
     double*,
+    int*,
     int*
 ) noexcept;
 
+// counters of Monte-Carlo events reported by PartMC's run_part_timestep() (reset by PartMC
+// whenever progress info is printed, i.e., if t_progress > 0) and wall time spent within
+// the run_part_timestep()/run_part_timeblock() calls, accumulated over subsequent calls
+struct RunPartStats {
+    int64_t n_samp = 0, n_coag = 0, n_emit = 0, n_dil_in = 0, n_dil_out = 0, n_nuc = 0;
+    double wall_time = 0;
+
+    void add(const int (&progress_counts)[6], const double wall_time) {
+        this->n_samp += progress_counts[0];
+        this->n_coag += progress_counts[1];
+        this->n_emit += progress_counts[2];
+        this->n_dil_in += progress_counts[3];
+        this->n_dil_out += progress_counts[4];
+        this->n_nuc += progress_counts[5];
+        this->wall_time += wall_time;
+    }
+};
+
 void run_part(
     const Scenario &scenario,
     EnvState &env_state,
@@ -88,7 +109,8 @@ std::tuple<double, double, int> run_part_timestep(
     const double &t_start,
     double &last_output_time,
     double &last_progress_time,
-    int &i_output
+    int &i_output,
+    RunPartStats *stats
 );
 
 std::tuple<double, double, int> run_part_timeblock(
@@ -106,5 +128,6 @@ std::tuple<double, double, int> run_part_timeblock(
     const double &t_start,
     double &last_output_time,
     double &last_progress_time,
-    int &i_output
+    int &i_output,
+    RunPartStats *stats
 );
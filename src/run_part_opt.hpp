@@ -8,6 +8,7 @@
 
 #include "pmc_resource.hpp"
 #include "json_resource.hpp"
+#include "pmc_lock.hpp"
 #include "pybind11_json/pybind11_json.hpp"
 
 extern "C" void f_run_part_opt_ctor(void *ptr) noexcept;
@@ -49,6 +50,7 @@ struct RunPartOpt {
             if (json_copy.find(key) == json_copy.end())
                 json_copy[key] = 0;
 
+        PMCLock lock;
         JSONResourceGuard<InputJSONResource> guard(json_copy);
         f_run_part_opt_from_json(this->ptr.f_arg());
         guard.check_parameters();
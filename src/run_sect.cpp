@@ -6,6 +6,7 @@
 
 #include "run_sect.hpp"
 #include "pybind11/stl.h"
+#include "pmc_lock.hpp"
 
 void run_sect(
     const BinGrid &bin_grid,
@@ -16,6 +17,7 @@ void run_sect(
     const EnvState &env_state,
     const RunSectOpt &run_sect_opt
 ) {
+    PMCLock lock;
     f_run_sect(
         bin_grid.ptr.f_arg(),
         gas_data.ptr.f_arg(),
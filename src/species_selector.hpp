@@ -0,0 +1,40 @@
+/*##################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+##################################################################################################*/
+
+#pragma once
+
+#include "aero_data.hpp"
+#include "tl/optional.hpp"
+
+struct SpeciesSelector {
+    std::shared_ptr<AeroData> aero_data;
+    std::vector<int> mask;
+
+    SpeciesSelector(
+        std::shared_ptr<AeroData> aero_data,
+        const tl::optional<std::valarray<std::string>> &include,
+        const tl::optional<std::valarray<std::string>> &exclude
+    ):
+        aero_data(aero_data),
+        mask(AeroData::__len__(*aero_data), !include.has_value())
+    {
+        if (include.has_value())
+            for (const auto &name : include.value())
+                mask[AeroData::spec_by_name(*aero_data, name)] = true;
+        if (exclude.has_value())
+            for (const auto &name : exclude.value())
+                mask[AeroData::spec_by_name(*aero_data, name)] = false;
+    }
+
+    static auto species(const SpeciesSelector &self) {
+        const auto names = AeroData::names(*self.aero_data);
+        auto selected = pybind11::list();
+        for (std::size_t idx = 0; idx < self.mask.size(); ++idx)
+            if (self.mask[idx])
+                selected.append(names[idx]);
+        return pybind11::tuple(selected);
+    }
+};
@@ -4,6 +4,10 @@
 # Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
 ####################################################################################################
 
+import numpy as np
+
+from PyPartMC import si
+
 ENV_STATE_CTOR_ARG_MINIMAL = {
     "rel_humidity": 0.0,
     "latitude": 0.0,
@@ -12,3 +16,96 @@ ENV_STATE_CTOR_ARG_MINIMAL = {
     "start_time": 44.0,
     "start_day": 0,
 }
+
+AERO_DATA_CTOR_ARG_FULL = (
+    #         density  ions in soln (1) molecular weight    kappa (1)
+    #         |                     |   |                   |
+    {"SO4": [1800 * si.kg / si.m**3, 1, 96.0 * si.g / si.mol, 0.00]},
+    {"NO3": [1800 * si.kg / si.m**3, 1, 62.0 * si.g / si.mol, 0.00]},
+    {"Cl": [2200 * si.kg / si.m**3, 1, 35.5 * si.g / si.mol, 0.00]},
+    {"NH4": [1800 * si.kg / si.m**3, 1, 18.0 * si.g / si.mol, 0.00]},
+    {"MSA": [1800 * si.kg / si.m**3, 0, 95.0 * si.g / si.mol, 0.53]},
+    {"ARO1": [1400 * si.kg / si.m**3, 0, 150.0 * si.g / si.mol, 0.10]},
+    {"ARO2": [1400 * si.kg / si.m**3, 0, 150.0 * si.g / si.mol, 0.10]},
+    {"ALK1": [1400 * si.kg / si.m**3, 0, 140.0 * si.g / si.mol, 0.10]},
+    {"OLE1": [1400 * si.kg / si.m**3, 0, 140.0 * si.g / si.mol, 0.10]},
+    {"API1": [1400 * si.kg / si.m**3, 0, 184.0 * si.g / si.mol, 0.10]},
+    {"API2": [1400 * si.kg / si.m**3, 0, 184.0 * si.g / si.mol, 0.10]},
+    {"LIM1": [1400 * si.kg / si.m**3, 0, 200.0 * si.g / si.mol, 0.10]},
+    {"LIM2": [1400 * si.kg / si.m**3, 0, 200.0 * si.g / si.mol, 0.10]},
+    {"CO3": [2600 * si.kg / si.m**3, 1, 60.0 * si.g / si.mol, 0.00]},
+    {"Na": [2200 * si.kg / si.m**3, 1, 23.0 * si.g / si.mol, 0.00]},
+    {"Ca": [2600 * si.kg / si.m**3, 1, 40.0 * si.g / si.mol, 0.00]},
+    {"OIN": [2600 * si.kg / si.m**3, 0, 1.0 * si.g / si.mol, 0.10]},
+    {"OC": [1400 * si.kg / si.m**3, 0, 1.0 * si.g / si.mol, 0.10]},
+    {"BC": [1800 * si.kg / si.m**3, 0, 1.0 * si.g / si.mol, 0.00]},
+    {"H2O": [1000 * si.kg / si.m**3, 0, 18.0 * si.g / si.mol, 0.00]},
+)
+
+AERO_MODE_CTOR_LOG_NORMAL = {
+    "test_mode": {
+        "mass_frac": [{"H2O": [1]}],
+        "diam_type": "geometric",
+        "mode_type": "log_normal",
+        "num_conc": 100 / si.m**3,
+        "geom_mean_diam": 2 * si.um,
+        "log10_geom_std_dev": np.log10(1.6),
+    }
+}
+
+AERO_MODE_CTOR_LOG_NORMAL_COAGULATION = {
+    "test_mode": {
+        "mass_frac": [{"SO4": [1]}],
+        "diam_type": "geometric",
+        "mode_type": "log_normal",
+        "num_conc": 1e12 / si.m**3,
+        "geom_mean_diam": 2 * si.um,
+        "log10_geom_std_dev": np.log10(1.6),
+    }
+}
+
+AERO_DIST_CTOR_ARG_COAGULATION = [
+    AERO_MODE_CTOR_LOG_NORMAL_COAGULATION,
+]
+
+ENV_STATE_CTOR_ARG_HIGH_RH = {**ENV_STATE_CTOR_ARG_MINIMAL}
+ENV_STATE_CTOR_ARG_HIGH_RH["rel_humidity"] = 0.95
+
+GAS_DATA_CTOR_ARG_MINIMAL = ("SO2",)
+
+RUN_PART_OPT_CTOR_ARG_SIMULATION = {
+    "output_prefix": "tests/test",
+    "do_coagulation": True,
+    "coag_kernel": "brown",
+    "do_parallel": False,
+    "do_nucleation": False,
+    "do_mosaic": False,
+    "do_condensation": False,
+    "do_camp_chem": False,
+    "t_max": 86400.0,
+    "del_t": 60 * si.s,
+    "t_output": 3600.0,
+    "t_progress": 0.0,
+    "rand_init": 0,
+    "allow_halving": False,
+    "allow_doubling": False,
+}
+
+SCENARIO_CTOR_ARG_SIMULATION = {
+    "temp_profile": [{"time": [0]}, {"temp": [273]}],
+    "pressure_profile": [{"time": [0]}, {"pressure": [1e5]}],
+    "height_profile": [{"time": [0]}, {"height": [1]}],
+    "gas_emissions": [{"time": [0]}, {"rate": [1]}, {"SO2": [1e-9]}],
+    "gas_background": [{"time": [0]}, {"rate": [0]}, {"SO2": [0]}],
+    "aero_emissions": [
+        {"time": [0]},
+        {"rate": [0]},
+        {"dist": [[AERO_MODE_CTOR_LOG_NORMAL]]},
+    ],
+    "aero_background": [
+        {"time": [0]},
+        {"rate": [0]},
+        {"dist": [[AERO_MODE_CTOR_LOG_NORMAL]]},
+    ],
+    "loss_function": "none",
+}
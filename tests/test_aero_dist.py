@@ -14,11 +14,10 @@ import pytest
 import PyPartMC as ppmc
 from PyPartMC import si
 
-from .test_aero_data import AERO_DATA_CTOR_ARG_FULL, AERO_DATA_CTOR_ARG_MINIMAL
+from .common import AERO_DATA_CTOR_ARG_FULL, AERO_MODE_CTOR_LOG_NORMAL
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
 from .test_aero_mode import (
     AERO_MODE_CTOR_EXP,
-    AERO_MODE_CTOR_LOG_NORMAL,
-    AERO_MODE_CTOR_LOG_NORMAL_COAGULATION,
     AERO_MODE_CTOR_LOG_NORMAL_FULL,
     AERO_MODE_CTOR_SAMPLED,
 )
@@ -31,10 +30,6 @@ AERO_DIST_CTOR_ARG_FULL = [
     AERO_MODE_CTOR_LOG_NORMAL_FULL,
 ]
 
-AERO_DIST_CTOR_ARG_COAGULATION = [
-    AERO_MODE_CTOR_LOG_NORMAL_COAGULATION,
-]
-
 AERO_DIST_CTOR_ARG_EXP = [
     AERO_MODE_CTOR_EXP,
 ]
@@ -13,20 +13,9 @@ import pytest
 import PyPartMC as ppmc
 from PyPartMC import si
 
+from .common import AERO_MODE_CTOR_LOG_NORMAL
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
 
-AERO_MODE_CTOR_LOG_NORMAL = {
-    "test_mode": {
-        "mass_frac": [{"H2O": [1]}],
-        "diam_type": "geometric",
-        "mode_type": "log_normal",
-        "num_conc": 100 / si.m**3,
-        "geom_mean_diam": 2 * si.um,
-        "log10_geom_std_dev": np.log10(1.6),
-    }
-}
-
-
 AERO_MODE_CTOR_LOG_NORMAL_FULL = {
     "test_mode": {
         "mass_frac": [{"SO4": [1]}],
@@ -38,17 +27,6 @@ AERO_MODE_CTOR_LOG_NORMAL_FULL = {
     }
 }
 
-AERO_MODE_CTOR_LOG_NORMAL_COAGULATION = {
-    "test_mode": {
-        "mass_frac": [{"SO4": [1]}],
-        "diam_type": "geometric",
-        "mode_type": "log_normal",
-        "num_conc": 1e12 / si.m**3,
-        "geom_mean_diam": 2 * si.um,
-        "log10_geom_std_dev": np.log10(1.6),
-    }
-}
-
 AERO_MODE_CTOR_SAMPLED = {
     "test_mode": {
         "mass_frac": [{"H2O": [1]}],
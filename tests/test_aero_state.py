@@ -11,8 +11,10 @@ import numpy as np
 import pytest
 
 import PyPartMC as ppmc
+from PyPartMC import si
 
-from .test_aero_data import AERO_DATA_CTOR_ARG_FULL, AERO_DATA_CTOR_ARG_MINIMAL
+from .common import AERO_DATA_CTOR_ARG_FULL
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
 from .test_aero_dist import (
     AERO_DIST_CTOR_ARG_AVERAGE,
     AERO_DIST_CTOR_ARG_FULL,
@@ -129,7 +131,7 @@ class TestAeroState:
         num_concs = sut_minimal.num_concs
 
         # assert
-        assert isinstance(num_concs, list)
+        assert isinstance(num_concs, np.ndarray)
         assert len(num_concs) == len(sut_minimal)
 
     @staticmethod
@@ -138,7 +140,7 @@ class TestAeroState:
         masses = sut_minimal.masses()
 
         # assert
-        assert isinstance(masses, list)
+        assert isinstance(masses, np.ndarray)
         assert len(masses) == len(sut_minimal)
 
     @staticmethod
@@ -153,7 +155,7 @@ class TestAeroState:
             masses_so4[i_part] = sut_full.particle(i_part).species_masses[so4_ind]
 
         # assert
-        assert isinstance(masses, list)
+        assert isinstance(masses, np.ndarray)
         assert len(masses) == len(sut_full)
         np.testing.assert_allclose(masses_so4, masses)
 
@@ -166,7 +168,7 @@ class TestAeroState:
             masses_so4[i_part] = sut_full.particle(i_part).species_mass(1)
 
         # assert
-        assert isinstance(masses, list)
+        assert isinstance(masses, np.ndarray)
         assert len(masses) == len(sut_full)
         np.testing.assert_allclose(masses_so4, masses)
 
@@ -176,17 +178,51 @@ class TestAeroState:
         masses = sut_full.masses(include=["SO4"], exclude=["SO4"])
 
         # assert
-        assert isinstance(masses, list)
+        assert isinstance(masses, np.ndarray)
         assert len(masses) == len(sut_full)
         assert np.sum(masses) == 0.0
 
+    @staticmethod
+    def test_masses_out(sut_minimal):
+        # arrange
+        out = np.empty(len(sut_minimal))
+
+        # act
+        masses = sut_minimal.masses(out=out)
+
+        # assert
+        assert masses is out
+        np.testing.assert_array_equal(out, sut_minimal.masses())
+
+    @staticmethod
+    @pytest.mark.parametrize(
+        "make_out",
+        (
+            lambda n: np.empty(n + 1),
+            lambda n: np.empty(n, dtype=np.float32),
+            lambda n: np.empty((n, 2))[:, 0],
+            lambda n: np.frombuffer(bytes(8 * n)),
+            lambda n: [0.0] * n,
+        ),
+    )
+    def test_masses_out_invalid(sut_minimal, make_out):
+        # arrange
+        out = make_out(len(sut_minimal))
+
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            sut_minimal.masses(out=out)
+
+        # assert
+        assert str(excinfo.value).startswith("out must be")
+
     @staticmethod
     def test_volumes(sut_minimal):
         # act
         volumes = sut_minimal.volumes()
 
         # assert
-        assert isinstance(volumes, list)
+        assert isinstance(volumes, np.ndarray)
         assert len(volumes) == len(sut_minimal)
 
     @staticmethod
@@ -201,7 +237,7 @@ class TestAeroState:
             vol_so4[i_part] = sut_full.particle(i_part).volumes[so4_ind]
 
         # assert
-        assert isinstance(volumes, list)
+        assert isinstance(volumes, np.ndarray)
         assert len(volumes) == len(sut_full)
         np.testing.assert_allclose(vol_so4, volumes)
 
@@ -211,7 +247,7 @@ class TestAeroState:
         volumes = sut_full.volumes(include=["SO4"], exclude=["SO4"])
 
         # assert
-        assert isinstance(volumes, list)
+        assert isinstance(volumes, np.ndarray)
         assert len(volumes) == len(sut_full)
         assert np.sum(volumes) == 0.0
 
@@ -230,7 +266,7 @@ class TestAeroState:
             )
 
         # assert
-        assert isinstance(volumes, list)
+        assert isinstance(volumes, np.ndarray)
         assert len(volumes) == len(sut_full)
         np.testing.assert_allclose(vol_so4, volumes)
 
@@ -240,7 +276,7 @@ class TestAeroState:
         dry_diameters = sut_minimal.dry_diameters
 
         # assert
-        assert isinstance(dry_diameters, list)
+        assert isinstance(dry_diameters, np.ndarray)
         assert len(dry_diameters) == len(sut_minimal)
 
     @staticmethod
@@ -252,7 +288,7 @@ class TestAeroState:
         diameters = sut_minimal.mobility_diameters(env_state)
 
         # assert
-        assert isinstance(diameters, list)
+        assert isinstance(diameters, np.ndarray)
         assert len(diameters) == len(sut_minimal)
         assert (np.asarray(diameters) > 0).all()
 
@@ -262,7 +298,7 @@ class TestAeroState:
         diameters = sut_minimal.diameters()
 
         # assert
-        assert isinstance(diameters, list)
+        assert isinstance(diameters, np.ndarray)
         assert len(diameters) == len(sut_minimal)
 
     @staticmethod
@@ -271,7 +307,7 @@ class TestAeroState:
         ids = sut_minimal.ids
 
         # assert
-        assert isinstance(ids, list)
+        assert isinstance(ids, np.ndarray)
         assert len(ids) == len(sut_minimal)
         assert (np.asarray(ids) > 0).all()
 
@@ -286,11 +322,40 @@ class TestAeroState:
         crit_rel_humids = sut_full.crit_rel_humids(env_state)
 
         # assert
-        assert isinstance(crit_rel_humids, list)
+        assert isinstance(crit_rel_humids, np.ndarray)
         assert len(crit_rel_humids) == len(sut_full)
         assert (np.asarray(crit_rel_humids) > 1).all()
         assert (np.asarray(crit_rel_humids) < 1.2).all()
 
+    @staticmethod
+    @pytest.mark.parametrize("kappa", (0.0, 0.001, 0.6, 1.28, 1.99))
+    @pytest.mark.parametrize(
+        "diameter_range", ((1e-9, 1e-8), (1e-8, 1e-6), (1e-6, 1e-4))
+    )
+    def test_crit_rel_humids_same_as_per_particle(kappa, diameter_range):
+        # arrange
+        aero_data = ppmc.AeroData(
+            (
+                {"H2O": [1000 * si.kg / si.m**3, 0, 18 * si.g / si.mol, 0]},
+                {"SALT": [2000 * si.kg / si.m**3, 0, 100 * si.g / si.mol, kappa]},
+            )
+        )
+        sut = ppmc.AeroState(aero_data, *AERO_STATE_CTOR_ARG_MINIMAL)
+        for diameter in np.geomspace(*diameter_range, 10):
+            sut.add_particle(ppmc.AeroParticle(aero_data, [0, np.pi / 6 * diameter**3]))
+        env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_MINIMAL)
+        env_state.set_temperature(300)
+
+        # act
+        crit_rel_humids = sut.crit_rel_humids(env_state)
+
+        # assert
+        np.testing.assert_allclose(
+            crit_rel_humids,
+            [sut.particle(i).crit_rel_humid(env_state) for i in range(len(sut))],
+            rtol=1e-12,
+        )
+
     @staticmethod
     def test_make_dry(sut_minimal):
         # act
@@ -299,6 +364,83 @@ class TestAeroState:
         masses = sut_minimal.masses(include=["H2O"])
         assert (np.asarray(masses) == 0).all()
 
+    @staticmethod
+    def test_to_arrays(sut_full):
+        # arrange
+        n_part = len(sut_full)
+        particle = sut_full.particle(n_part - 1)
+
+        # act
+        arrays = sut_full.to_arrays()
+
+        # assert
+        assert arrays["volumes"].shape == (n_part, len(particle.volumes))
+        np.testing.assert_array_equal(arrays["volumes"][-1], particle.volumes)
+        np.testing.assert_allclose(arrays["volumes"].sum(axis=1), sut_full.volumes())
+        np.testing.assert_array_equal(arrays["num_concs"], sut_full.num_concs)
+        np.testing.assert_array_equal(arrays["ids"], sut_full.ids)
+        assert (arrays["weight_groups"] >= 0).all()
+        assert (arrays["weight_classes"] >= 0).all()
+        assert arrays["least_create_times"][-1] == particle.least_create_time
+        assert arrays["greatest_create_times"][-1] == particle.greatest_create_time
+        assert arrays["sources"].shape == (n_part, len(particle.sources))
+        np.testing.assert_array_equal(arrays["sources"][-1], particle.sources)
+
+    @staticmethod
+    def test_diagnostics(sut_full):
+        # arrange
+        env_state = ppmc.EnvState({**ENV_STATE_CTOR_ARG_MINIMAL, "rel_humidity": 0.8})
+        env_state.set_temperature(300)
+        quantities = (
+            "num_concs",
+            "masses",
+            "volumes",
+            "diameters",
+            "dry_diameters",
+            "mobility_diameters",
+            "crit_rel_humids",
+        )
+
+        # act
+        diagnostics = sut_full.diagnostics(quantities, env_state)
+
+        # assert
+        assert tuple(diagnostics.keys()) == quantities
+        np.testing.assert_allclose(diagnostics["num_concs"], sut_full.num_concs)
+        np.testing.assert_allclose(diagnostics["masses"], sut_full.masses())
+        np.testing.assert_allclose(diagnostics["volumes"], sut_full.volumes())
+        np.testing.assert_allclose(diagnostics["diameters"], sut_full.diameters())
+        np.testing.assert_allclose(
+            diagnostics["dry_diameters"], sut_full.dry_diameters
+        )
+        np.testing.assert_allclose(
+            diagnostics["mobility_diameters"], sut_full.mobility_diameters(env_state)
+        )
+        np.testing.assert_array_equal(
+            diagnostics["crit_rel_humids"], sut_full.crit_rel_humids(env_state)
+        )
+
+    @staticmethod
+    @pytest.mark.parametrize(
+        "quantities, message",
+        (
+            (
+                ["masses", "kopytko"],
+                "unknown quantity 'kopytko', valid options are: crit_rel_humids, "
+                + "diameters, dry_diameters, masses, mobility_diameters, num_concs, "
+                + "volumes",
+            ),
+            (["crit_rel_humids"], "env_state is required for crit_rel_humids"),
+        ),
+    )
+    def test_diagnostics_invalid(sut_minimal, quantities, message):
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            sut_minimal.diagnostics(quantities)
+
+        # assert
+        assert str(excinfo.value) == message
+
     @staticmethod
     def test_mixing_state(sut_minimal):
         # act
@@ -381,7 +523,7 @@ class TestAeroState:
         diameters = sut_minimal.diameters()
         sut_minimal.remove_particle(len(sut_minimal) - 1)
 
-        assert diameters[0:-1] == sut_minimal.diameters()
+        np.testing.assert_array_equal(diameters[0:-1], sut_minimal.diameters())
 
     @staticmethod
     def test_zero(sut_minimal):
@@ -402,6 +544,74 @@ class TestAeroState:
         assert len(sut) == 1
         assert sut.particle(0).diameter == sut_minimal.particle(1).diameter
 
+    @staticmethod
+    def test_add_particles_from_arrays():
+        # arrange
+        aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+        aero_dist = ppmc.AeroDist(aero_data, AERO_DIST_CTOR_ARG_FULL)
+        aero_state = ppmc.AeroState(aero_data, *AERO_STATE_CTOR_ARG_MINIMAL)
+        _ = aero_state.dist_sample(aero_dist, 1.0, 0.0, True, True)
+        expected = aero_state.to_arrays()
+        sut = ppmc.AeroState(aero_data, *AERO_STATE_CTOR_ARG_MINIMAL)
+        sut.copy_weight(aero_state)
+
+        # act
+        sut.add_particles_from_arrays(
+            expected["volumes"],
+            weight_groups=expected["weight_groups"],
+            weight_classes=expected["weight_classes"],
+            create_times=expected["least_create_times"],
+            sources=expected["sources"].argmax(axis=1),
+        )
+
+        # assert
+        actual = sut.to_arrays()
+        assert len(sut) == len(aero_state)
+        for key in (
+            "volumes", "num_concs", "weight_groups", "weight_classes", "sources"
+        ):
+            np.testing.assert_array_equal(actual[key], expected[key])
+        assert len(set(actual["ids"]) & set(expected["ids"])) == 0
+
+    @staticmethod
+    def test_add_particles_from_arrays_shape_mismatch(sut_minimal):
+        # arrange
+        n_spec = len(sut_minimal.particle(0).volumes)
+
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            sut_minimal.add_particles_from_arrays(np.ones((2, n_spec + 1)))
+
+        # assert
+        assert str(excinfo.value) == (
+            "volumes must be a 2D array of shape (n_part, n_spec)"
+        )
+
+    @staticmethod
+    @pytest.mark.parametrize(
+        "kwargs, message",
+        (
+            ({"weight_groups": [-1, 0]}, "weight group index out of range"),
+            ({"weight_groups": [0, 1000]}, "weight group index out of range"),
+            ({"weight_classes": [0, -1]}, "weight class index out of range"),
+            ({"weight_classes": [1000, 0]}, "weight class index out of range"),
+        ),
+    )
+    def test_add_particles_from_arrays_weight_out_of_range(
+        sut_minimal, kwargs, message
+    ):
+        # arrange
+        n_spec = len(sut_minimal.particle(0).volumes)
+        n_part = len(sut_minimal)
+
+        # act
+        with pytest.raises(IndexError) as excinfo:
+            sut_minimal.add_particles_from_arrays(np.ones((2, n_spec)), **kwargs)
+
+        # assert
+        assert str(excinfo.value) == message
+        assert len(sut_minimal) == n_part
+
     @staticmethod
     def test_add_particles(sut_minimal):
         aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_MINIMAL)
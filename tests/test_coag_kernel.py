@@ -0,0 +1,102 @@
+####################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+####################################################################################################
+
+import platform
+
+import numpy as np
+import pytest
+
+import PyPartMC as ppmc
+from PyPartMC import si
+
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
+
+VOLUMES_A = (1e-18, 1e-20, 1e-22)
+VOLUMES_B = (3e-19, 3e-21)
+
+
+@pytest.fixture(name="args")
+def args_fixture():
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_MINIMAL)
+    env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_MINIMAL)
+    env_state.set_temperature(300 * si.K)
+    env_state.pressure = 1000 * si.hPa
+    particles_a = [ppmc.AeroParticle(aero_data, [vol]) for vol in VOLUMES_A]
+    particles_b = [ppmc.AeroParticle(aero_data, [vol]) for vol in VOLUMES_B]
+    return particles_a, particles_b, env_state
+
+
+class TestCoagKernel:
+    @staticmethod
+    def test_additive(args):
+        # arrange
+        particles_a, particles_b, env_state = args
+        env_state.additive_kernel_coefficient = 1000
+
+        # act
+        k = ppmc.coag_kernel("additive", particles_a, particles_b, env_state)
+
+        # assert
+        np.testing.assert_allclose(
+            k, 1000 * np.add.outer(np.array(VOLUMES_A), np.array(VOLUMES_B))
+        )
+
+    @staticmethod
+    @pytest.mark.parametrize("kernel_type", ("brown", "sedi", "brown_free"))
+    def test_symmetric(args, kernel_type):
+        # arrange
+        particles_a, particles_b, env_state = args
+
+        # act
+        k_ab = ppmc.coag_kernel(kernel_type, particles_a, particles_b, env_state)
+        k_ba = ppmc.coag_kernel(kernel_type, particles_b, particles_a, env_state)
+
+        # assert
+        assert k_ab.shape == (len(VOLUMES_A), len(VOLUMES_B))
+        assert (k_ab >= 0).all()
+        np.testing.assert_allclose(k_ab, k_ba.T)
+
+    @staticmethod
+    def test_zero(args):
+        # act
+        k = ppmc.coag_kernel("zero", *args)
+
+        # assert
+        np.testing.assert_array_equal(k, 0)
+
+    @staticmethod
+    def test_empty(args):
+        # arrange
+        particles_a, _, env_state = args
+
+        # act
+        k = ppmc.coag_kernel("brown", particles_a, [], env_state)
+
+        # assert
+        assert k.shape == (len(VOLUMES_A), 0)
+
+    @staticmethod
+    @pytest.mark.skipif(platform.machine() == "arm64", reason="TODO #348")
+    def test_unknown_kernel_type(args):
+        # act
+        with pytest.raises(RuntimeError):
+            ppmc.coag_kernel("kopytko", *args)
+
+    @staticmethod
+    def test_different_aero_data(args):
+        # arrange
+        particles_a, _, env_state = args
+        particles_b = [
+            ppmc.AeroParticle(ppmc.AeroData(AERO_DATA_CTOR_ARG_MINIMAL), [1e-18])
+        ]
+
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            ppmc.coag_kernel("brown", particles_a, particles_b, env_state)
+
+        # assert
+        assert str(excinfo.value) == "all particles must share the same AeroData"
@@ -4,19 +4,35 @@
 # Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
 ####################################################################################################
 
+import platform
+
 import numpy as np
 import pytest
 
 import PyPartMC as ppmc
 from PyPartMC import si
 
+from .common import AERO_DATA_CTOR_ARG_FULL, ENV_STATE_CTOR_ARG_HIGH_RH
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_aero_dist import AERO_DIST_CTOR_ARG_FULL
 from .test_aero_state import AERO_STATE_CTOR_ARG_MINIMAL
 from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
 
 # pylint: disable=unused-variable
 
 
+def make_sampled_state(weighting=AERO_STATE_CTOR_ARG_MINIMAL[1]):
+    env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_HIGH_RH)
+    env_state.set_temperature(300)
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    aero_state = ppmc.AeroState(aero_data, AERO_STATE_CTOR_ARG_MINIMAL[0], weighting)
+    ppmc.rand_init(44)
+    aero_state.dist_sample(
+        ppmc.AeroDist(aero_data, AERO_DIST_CTOR_ARG_FULL), 1.0, 0.0, True, True
+    )
+    return env_state, aero_data, aero_state
+
+
 class TestCondense:
     @staticmethod
     def test_equilib_particles():
@@ -31,6 +47,104 @@ class TestCondense:
         # assert
         pass
 
+    @staticmethod
+    @pytest.mark.parametrize("n_threads", (0, 2, 7))
+    def test_equilib_particles_threads(n_threads):
+        # arrange
+        serial = make_sampled_state()
+        sut = make_sampled_state()
+
+        # act
+        ppmc.rand_init(11)
+        ppmc.condense_equilib_particles(*serial, n_threads=1)
+        ppmc.rand_init(11)
+        ppmc.condense_equilib_particles(*sut, n_threads=n_threads)
+
+        # assert
+        assert sut[2].total_num_conc == serial[2].total_num_conc
+        np.testing.assert_array_equal(sut[2].volumes(), serial[2].volumes())
+
+    @staticmethod
+    @pytest.mark.parametrize("n_threads", (1, 3))
+    def test_equilib_particles_same_as_partmc(n_threads):
+        # arrange
+        partmc = make_sampled_state()
+        sut = make_sampled_state()
+
+        # act
+        ppmc.rand_init(11)
+        ppmc.condense_equilib_particles(*partmc, n_threads=1)
+        ppmc.rand_init(11)
+        ppmc.condense_equilib_particles(
+            *sut, indices=list(range(len(sut[2]))), n_threads=n_threads
+        )
+
+        # assert
+        assert sut[2].total_num_conc == partmc[2].total_num_conc
+        np.testing.assert_array_equal(sut[2].volumes(), partmc[2].volumes())
+
+    @staticmethod
+    def test_equilib_particles_subset():
+        # arrange
+        sut = make_sampled_state(weighting="flat")
+        volumes = sut[2].volumes()
+        indices = [0, 3, 3, len(volumes) - 1]
+        others = np.setdiff1d(np.arange(len(volumes)), indices)
+
+        # act
+        ppmc.condense_equilib_particles(*sut, indices=indices)
+
+        # assert
+        assert (sut[2].volumes()[indices] > volumes[indices]).all()
+        np.testing.assert_array_equal(sut[2].volumes()[others], volumes[others])
+
+    @staticmethod
+    def test_equilib_particles_index_out_of_range():
+        # arrange
+        sut = make_sampled_state()
+
+        # act
+        with pytest.raises(IndexError) as excinfo:
+            ppmc.condense_equilib_particles(*sut, indices=[len(sut[2])])
+
+        # assert
+        assert str(excinfo.value) == "particle index out of range"
+
+    @staticmethod
+    @pytest.mark.skipif(platform.machine() == "arm64", reason="TODO #348")
+    def test_equilib_particles_failing_chunk():
+        # arrange
+        env_state, aero_data, aero_state = make_sampled_state()
+        aero_state.add_particle(ppmc.AeroParticle(aero_data, [0] * len(aero_data)))
+        volumes = aero_state.volumes()
+        first_chunk = slice(0, len(volumes) // 2)
+
+        # act
+        with pytest.raises(RuntimeError):
+            ppmc.condense_equilib_particles(
+                env_state, aero_data, aero_state, n_threads=2
+            )
+
+        # assert
+        assert (aero_state.volumes()[first_chunk] > volumes[first_chunk]).all()
+
+    @staticmethod
+    def test_condense_particles():
+        # arrange
+        env_state, aero_data, aero_state = make_sampled_state()
+        env_state.pressure = 1000 * si.hPa
+        env_state_final = ppmc.EnvState(ENV_STATE_CTOR_ARG_HIGH_RH)
+        env_state_final.set_temperature(300)
+        env_state_final.pressure = 1000 * si.hPa
+        volumes = aero_state.volumes()
+
+        # act
+        ppmc.condense_particles(aero_state, env_state, env_state_final, 1 * si.s)
+
+        # assert
+        assert (aero_state.volumes() > volumes).all()
+        assert env_state_final.rh <= env_state.rh
+
     @staticmethod
     @pytest.mark.parametrize(
         "aero_data_params",
@@ -10,9 +10,8 @@ import pytest
 
 import PyPartMC as ppmc
 
+from .common import AERO_MODE_CTOR_LOG_NORMAL, GAS_DATA_CTOR_ARG_MINIMAL
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
-from .test_aero_mode import AERO_MODE_CTOR_LOG_NORMAL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
 
 
 @pytest.mark.parametrize(
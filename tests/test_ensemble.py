@@ -0,0 +1,104 @@
+####################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+####################################################################################################
+
+import numpy as np
+import pytest
+
+import PyPartMC as ppmc
+
+from .common import GAS_DATA_CTOR_ARG_MINIMAL, RUN_PART_OPT_CTOR_ARG_SIMULATION
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_aero_dist import AERO_DIST_CTOR_ARG_MINIMAL
+from .test_aero_state import AERO_STATE_CTOR_ARG_MINIMAL
+from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
+from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
+
+
+def make_sut(tmp_path, run_part_opt=None, **kwargs):
+    return ppmc.EnsembleRunner(
+        aero_data=AERO_DATA_CTOR_ARG_MINIMAL,
+        gas_data=GAS_DATA_CTOR_ARG_MINIMAL,
+        scenario=SCENARIO_CTOR_ARG_MINIMAL,
+        env_state=ENV_STATE_CTOR_ARG_MINIMAL,
+        aero_state=AERO_STATE_CTOR_ARG_MINIMAL,
+        aero_dist=AERO_DIST_CTOR_ARG_MINIMAL,
+        run_part_opt={
+            **RUN_PART_OPT_CTOR_ARG_SIMULATION,
+            "output_prefix": str(tmp_path / "test"),
+            **(run_part_opt or {}),
+        },
+        **kwargs,
+    )
+
+
+class TestEnsembleRunner:
+    @staticmethod
+    def test_run(tmp_path):
+        # arrange
+        sut = make_sut(tmp_path, n_workers=2)
+        seeds = (11, 22, 11)
+
+        # act
+        results = sut.run(seeds)
+
+        # assert
+        assert [result["seed"] for result in results] == list(seeds)
+        for result in results:
+            assert (
+                result["env_state"]["elapsed_time"]
+                == RUN_PART_OPT_CTOR_ARG_SIMULATION["t_max"]
+            )
+        for key in ("volumes", "num_concs"):
+            np.testing.assert_array_equal(
+                results[0]["aero_state"][key], results[2]["aero_state"][key]
+            )
+
+    @staticmethod
+    @pytest.mark.parametrize(
+        "flags",
+        (
+            {"allow_doubling": True, "allow_halving": False},
+            {"allow_doubling": False, "allow_halving": True},
+        ),
+    )
+    def test_run_different_allow_flags(tmp_path, flags):
+        # arrange
+        sut = make_sut(tmp_path, run_part_opt=flags, n_workers=1)
+
+        # act
+        results = sut.run((33,))
+
+        # assert
+        assert (
+            results[0]["env_state"]["elapsed_time"]
+            == RUN_PART_OPT_CTOR_ARG_SIMULATION["t_max"]
+        )
+
+    @staticmethod
+    def test_run_seeds_from_generator(tmp_path):
+        # arrange
+        sut = make_sut(tmp_path, n_workers=2)
+        seeds = (44, 55)
+
+        # act
+        results = sut.run(seed for seed in seeds)
+
+        # assert
+        assert [result["seed"] for result in results] == list(seeds)
+
+    @staticmethod
+    def test_zero_seed(tmp_path):
+        # arrange
+        sut = make_sut(tmp_path)
+
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            sut.run((1, 0))
+
+        # assert
+        assert (
+            str(excinfo.value) == "seeds must be non-zero (0 means a time-based seed)"
+        )
@@ -5,20 +5,17 @@
 ####################################################################################################
 
 import gc
+from concurrent.futures import ThreadPoolExecutor
 
 import pytest
 
 import PyPartMC as ppmc
 from PyPartMC import si
 
-from .common import ENV_STATE_CTOR_ARG_MINIMAL
+from .common import ENV_STATE_CTOR_ARG_MINIMAL, GAS_DATA_CTOR_ARG_MINIMAL
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
 from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
 
-ENV_STATE_CTOR_ARG_HIGH_RH = {**ENV_STATE_CTOR_ARG_MINIMAL}
-ENV_STATE_CTOR_ARG_HIGH_RH["rel_humidity"] = 0.95
-
 
 class TestEnvState:
     @staticmethod
@@ -119,3 +116,22 @@ class TestEnvState:
 
         # assert
         assert 1 * si.kg / si.m**3 < env_state.air_density < 1.5 * si.kg / si.m**3
+
+    @staticmethod
+    def test_ctor_concurrent():
+        # arrange
+        start_times = tuple(float(i) for i in range(64))
+
+        # act
+        with ThreadPoolExecutor(max_workers=8) as executor:
+            env_states = tuple(
+                executor.map(
+                    lambda start_time: ppmc.EnvState(
+                        {**ENV_STATE_CTOR_ARG_MINIMAL, "start_time": start_time}
+                    ),
+                    start_times,
+                )
+            )
+
+        # assert
+        assert tuple(env_state.start_time for env_state in env_states) == start_times
@@ -10,7 +10,7 @@ import pytest
 
 import PyPartMC as ppmc
 
-GAS_DATA_CTOR_ARG_MINIMAL = ("SO2",)
+from .common import GAS_DATA_CTOR_ARG_MINIMAL
 
 
 class TestGasData:
@@ -11,7 +11,7 @@ import pytest
 
 import PyPartMC as ppmc
 
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
+from .common import GAS_DATA_CTOR_ARG_MINIMAL
 
 GAS_DATA_MINIMAL = ppmc.GasData(GAS_DATA_CTOR_ARG_MINIMAL)
 
@@ -5,10 +5,13 @@ import pytest
 
 import PyPartMC as ppmc
 
-from .common import ENV_STATE_CTOR_ARG_MINIMAL
+from .common import (
+    AERO_MODE_CTOR_LOG_NORMAL,
+    ENV_STATE_CTOR_ARG_MINIMAL,
+    GAS_DATA_CTOR_ARG_MINIMAL,
+)
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
-from .test_aero_mode import AERO_MODE_CTOR_LOG_NORMAL, AERO_MODE_CTOR_SAMPLED
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
+from .test_aero_mode import AERO_MODE_CTOR_SAMPLED
 from .test_run_part_opt import RUN_PART_OPT_CTOR_ARG_MINIMAL
 from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
 
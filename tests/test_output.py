@@ -10,18 +10,19 @@ import numpy as np
 
 import PyPartMC as ppmc
 
-from .test_aero_data import AERO_DATA_CTOR_ARG_FULL, AERO_DATA_CTOR_ARG_MINIMAL
-from .test_aero_dist import (
+from .common import (
+    AERO_DATA_CTOR_ARG_FULL,
     AERO_DIST_CTOR_ARG_COAGULATION,
-    AERO_DIST_CTOR_ARG_EXP,
-    AERO_DIST_CTOR_ARG_MINIMAL,
+    GAS_DATA_CTOR_ARG_MINIMAL,
+    RUN_PART_OPT_CTOR_ARG_SIMULATION,
+    SCENARIO_CTOR_ARG_SIMULATION,
 )
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_aero_dist import AERO_DIST_CTOR_ARG_EXP, AERO_DIST_CTOR_ARG_MINIMAL
 from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
 from .test_run_exact_opt import RUN_EXACT_OPT_CTOR_ARG_SIMULATION
-from .test_run_part_opt import RUN_PART_OPT_CTOR_ARG_SIMULATION
 from .test_run_sect_opt import RUN_SECT_OPT_CTOR_ARG_SIMULATION
-from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL, SCENARIO_CTOR_ARG_SIMULATION
+from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
 
 
 class TestOutput:
@@ -92,7 +93,7 @@ class TestOutput:
             photolysis,
         )
 
-        assert aero_state.num_concs != num_concs
+        assert not np.array_equal(aero_state.num_concs, num_concs)
 
         aero_data, aero_state, gas_data, gas_state, env_state = ppmc.input_state(
             str(filename) + "_0001_00000001.nc"
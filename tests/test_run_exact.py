@@ -8,10 +8,10 @@ import pytest
 
 import PyPartMC as ppmc
 
+from .common import GAS_DATA_CTOR_ARG_MINIMAL
 from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
 from .test_aero_dist import AERO_DIST_CTOR_ARG_EXP
 from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
 from .test_run_exact_opt import RUN_EXACT_OPT_CTOR_ARG_SIMULATION
 from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
 
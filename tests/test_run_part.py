@@ -5,30 +5,33 @@
 ####################################################################################################
 
 import platform
+import threading
 
 import numpy as np
 import pytest
 
 import PyPartMC as ppmc
 
-from .test_aero_data import AERO_DATA_CTOR_ARG_FULL, AERO_DATA_CTOR_ARG_MINIMAL
-from .test_aero_dist import AERO_DIST_CTOR_ARG_FULL
+from .common import (
+    AERO_DATA_CTOR_ARG_FULL,
+    ENV_STATE_CTOR_ARG_HIGH_RH,
+    GAS_DATA_CTOR_ARG_MINIMAL,
+    RUN_PART_OPT_CTOR_ARG_SIMULATION,
+)
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_aero_dist import AERO_DIST_CTOR_ARG_FULL, AERO_DIST_CTOR_ARG_MINIMAL
 from .test_aero_state import AERO_STATE_CTOR_ARG_MINIMAL
-from .test_env_state import ENV_STATE_CTOR_ARG_HIGH_RH, ENV_STATE_CTOR_ARG_MINIMAL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
-from .test_run_part_opt import RUN_PART_OPT_CTOR_ARG_SIMULATION
+from .test_env_state import ENV_STATE_CTOR_ARG_MINIMAL
 from .test_scenario import SCENARIO_CTOR_ARG_MINIMAL
 
 
-@pytest.fixture(name="common_args")
-def common_args_fixture(tmp_path):
+def make_common_args(filename):
     aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_MINIMAL)
     gas_data = ppmc.GasData(GAS_DATA_CTOR_ARG_MINIMAL)
     gas_state = ppmc.GasState(gas_data)
     scenario = ppmc.Scenario(gas_data, aero_data, SCENARIO_CTOR_ARG_MINIMAL)
     env_state = ppmc.EnvState(ENV_STATE_CTOR_ARG_MINIMAL)
     scenario.init_env_state(env_state, 0.0)
-    filename = tmp_path / "test"
     run_part_opt = ppmc.RunPartOpt(
         {**RUN_PART_OPT_CTOR_ARG_SIMULATION, "output_prefix": str(filename)}
     )
@@ -45,6 +48,25 @@ def common_args_fixture(tmp_path):
     )
 
 
+def make_sampled_args(filename):
+    args = make_common_args(filename)
+    ppmc.rand_init(44)
+    args[3].dist_sample(
+        ppmc.AeroDist(args[2], AERO_DIST_CTOR_ARG_MINIMAL), 1.0, 0.0, False, False
+    )
+    return args
+
+
+def summarize(args):
+    aero_state = args[3]
+    return len(aero_state), np.dot(aero_state.masses(), aero_state.num_concs)
+
+
+@pytest.fixture(name="common_args")
+def common_args_fixture(tmp_path):
+    return make_common_args(tmp_path / "test")
+
+
 class TestRunPart:
     @staticmethod
     def test_run_part(common_args):
@@ -52,6 +74,34 @@ class TestRunPart:
 
         assert common_args[1].elapsed_time == RUN_PART_OPT_CTOR_ARG_SIMULATION["t_max"]
 
+    @staticmethod
+    def test_run_part_concurrent(tmp_path):
+        # arrange
+        serial = [make_sampled_args(tmp_path / f"serial_{i}") for i in range(2)]
+        concurrent = [make_sampled_args(tmp_path / f"test_{i}") for i in range(2)]
+        threads = [
+            threading.Thread(target=ppmc.run_part, args=thread_args)
+            for thread_args in concurrent
+        ]
+
+        # act
+        ppmc.rand_init(11)
+        for args in serial:
+            ppmc.run_part(*args)
+        ppmc.rand_init(11)
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        # assert
+        for thread_args in concurrent:
+            assert (
+                thread_args[1].elapsed_time == RUN_PART_OPT_CTOR_ARG_SIMULATION["t_max"]
+            )
+        # runs share PartMC's RNG stream and are serialised by the lock, in any order
+        assert sorted(map(summarize, concurrent)) == sorted(map(summarize, serial))
+
     @staticmethod
     def test_run_part_timestep(common_args):
         last_output_time, last_progress_time, i_output = ppmc.run_part_timestep(
@@ -81,6 +131,26 @@ class TestRunPart:
         assert last_progress_time == 0.0
         assert i_output == 2
 
+    @staticmethod
+    def test_run_part_timeblock_stats(common_args):
+        # arrange
+        num_times = int(
+            RUN_PART_OPT_CTOR_ARG_SIMULATION["t_output"]
+            / RUN_PART_OPT_CTOR_ARG_SIMULATION["del_t"]
+        )
+        sut = ppmc.RunPartStats()
+        assert sut.wall_time == 0
+
+        # act
+        ppmc.run_part_timeblock(*common_args, 1, num_times, 0, 0, 0, 1, stats=sut)
+        wall_time = sut.wall_time
+        ppmc.run_part_timestep(*common_args, num_times + 1, 0, 0, 0, 2, stats=sut)
+
+        # assert
+        assert sut.wall_time > wall_time > 0
+        assert sut.n_samp >= sut.n_coag >= 0
+        assert sut.n_emit == sut.n_dil_in == sut.n_dil_out == sut.n_nuc == 0
+
     @staticmethod
     def test_run_part_do_condensation(common_args, tmp_path):
         filename = tmp_path / "test"
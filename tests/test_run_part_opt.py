@@ -11,6 +11,8 @@ import pytest
 import PyPartMC as ppmc
 from PyPartMC import si
 
+from .common import RUN_PART_OPT_CTOR_ARG_SIMULATION
+
 RUN_PART_OPT_CTOR_ARG_MINIMAL = {
     "output_prefix": "tests/test",
     "do_coagulation": False,
@@ -18,24 +20,6 @@ RUN_PART_OPT_CTOR_ARG_MINIMAL = {
     "del_t": 1 * si.s,
 }
 
-RUN_PART_OPT_CTOR_ARG_SIMULATION = {
-    "output_prefix": "tests/test",
-    "do_coagulation": True,
-    "coag_kernel": "brown",
-    "do_parallel": False,
-    "do_nucleation": False,
-    "do_mosaic": False,
-    "do_condensation": False,
-    "do_camp_chem": False,
-    "t_max": 86400.0,
-    "del_t": 60 * si.s,
-    "t_output": 3600.0,
-    "t_progress": 0.0,
-    "rand_init": 0,
-    "allow_halving": False,
-    "allow_doubling": False,
-}
-
 
 class TestRunPartOpt:
     @staticmethod
@@ -13,10 +13,14 @@ import pytest
 
 import PyPartMC as ppmc
 
-from .common import ENV_STATE_CTOR_ARG_MINIMAL
-from .test_aero_data import AERO_DATA_CTOR_ARG_FULL, AERO_DATA_CTOR_ARG_MINIMAL
-from .test_aero_mode import AERO_MODE_CTOR_LOG_NORMAL, AERO_MODE_CTOR_LOG_NORMAL_FULL
-from .test_gas_data import GAS_DATA_CTOR_ARG_MINIMAL
+from .common import (
+    AERO_DATA_CTOR_ARG_FULL,
+    AERO_MODE_CTOR_LOG_NORMAL,
+    ENV_STATE_CTOR_ARG_MINIMAL,
+    GAS_DATA_CTOR_ARG_MINIMAL,
+)
+from .test_aero_data import AERO_DATA_CTOR_ARG_MINIMAL
+from .test_aero_mode import AERO_MODE_CTOR_LOG_NORMAL_FULL
 
 SCENARIO_CTOR_ARG_MINIMAL = {
     "temp_profile": [{"time": [0]}, {"temp": [273]}],
@@ -37,25 +41,6 @@ SCENARIO_CTOR_ARG_MINIMAL = {
     "loss_function": "none",
 }
 
-SCENARIO_CTOR_ARG_SIMULATION = {
-    "temp_profile": [{"time": [0]}, {"temp": [273]}],
-    "pressure_profile": [{"time": [0]}, {"pressure": [1e5]}],
-    "height_profile": [{"time": [0]}, {"height": [1]}],
-    "gas_emissions": [{"time": [0]}, {"rate": [1]}, {"SO2": [1e-9]}],
-    "gas_background": [{"time": [0]}, {"rate": [0]}, {"SO2": [0]}],
-    "aero_emissions": [
-        {"time": [0]},
-        {"rate": [0]},
-        {"dist": [[AERO_MODE_CTOR_LOG_NORMAL]]},
-    ],
-    "aero_background": [
-        {"time": [0]},
-        {"rate": [0]},
-        {"dist": [[AERO_MODE_CTOR_LOG_NORMAL]]},
-    ],
-    "loss_function": "none",
-}
-
 
 class TestScenario:
     @staticmethod
@@ -0,0 +1,124 @@
+####################################################################################################
+# This file is a part of PyPartMC licensed under the GNU General Public License v3 (LICENSE file)  #
+# Copyright (C) 2025 University of Illinois Urbana-Champaign                                       #
+# Authors: https://github.com/open-atmos/PyPartMC/graphs/contributors                              #
+####################################################################################################
+
+import numpy as np
+import pytest
+
+import PyPartMC as ppmc
+
+from .common import AERO_DATA_CTOR_ARG_FULL
+from .test_aero_dist import AERO_DIST_CTOR_ARG_FULL
+from .test_aero_state import AERO_STATE_CTOR_ARG_MINIMAL
+
+FILTERS = (
+    {"include": ["SO4"]},
+    {"exclude": ["SO4"]},
+    {"include": ["SO4", "NO3", "H2O"], "exclude": ["H2O"]},
+    {},
+)
+
+
+@pytest.fixture(name="aero_state")
+def aero_state_fixture():
+    aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+    aero_dist = ppmc.AeroDist(aero_data, AERO_DIST_CTOR_ARG_FULL)
+    aero_state = ppmc.AeroState(aero_data, *AERO_STATE_CTOR_ARG_MINIMAL)
+    _ = aero_state.dist_sample(aero_dist, 1.0, 0.0, True, True)
+    return aero_data, aero_state
+
+
+class TestSpeciesSelector:
+    @staticmethod
+    def test_species():
+        # arrange
+        aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+
+        # act
+        sut = ppmc.SpeciesSelector(aero_data, include=["NO3", "SO4"])
+
+        # assert
+        assert sut.species == ("SO4", "NO3")
+        assert ppmc.SpeciesSelector(aero_data).species == aero_data.species
+
+    @staticmethod
+    def test_unknown_species():
+        # arrange
+        aero_data = ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL)
+
+        # act
+        with pytest.raises(RuntimeError) as excinfo:
+            ppmc.SpeciesSelector(aero_data, exclude=["XYZ"])
+
+        # assert
+        assert str(excinfo.value) == "Element not found."
+
+    @staticmethod
+    @pytest.mark.parametrize("filters", FILTERS)
+    @pytest.mark.parametrize("method", ("masses", "volumes", "diameters"))
+    def test_same_as_names(aero_state, filters, method):
+        # arrange
+        aero_data, aero_state = aero_state
+        sut = ppmc.SpeciesSelector(aero_data, **filters)
+
+        # act
+        actual = getattr(aero_state, method)(sut)
+
+        # assert
+        np.testing.assert_allclose(actual, getattr(aero_state, method)(**filters))
+
+    @staticmethod
+    @pytest.mark.parametrize("filters", FILTERS)
+    def test_mixing_state_same_as_names(aero_state, filters):
+        # arrange
+        aero_data, aero_state = aero_state
+        sut = ppmc.SpeciesSelector(aero_data, **filters)
+
+        # act
+        actual = aero_state.mixing_state(sut)
+
+        # assert
+        np.testing.assert_allclose(actual, aero_state.mixing_state(**filters))
+
+    @staticmethod
+    @pytest.mark.parametrize("group", (["SO4", "NO3"], ["BC", "OC", "SO4"]))
+    def test_mixing_state_group_same_as_names(aero_state, group):
+        # arrange
+        aero_data, aero_state = aero_state
+        sut = ppmc.SpeciesSelector(aero_data, exclude=["H2O"])
+
+        # act
+        actual = aero_state.mixing_state(sut, group=group)
+
+        # assert
+        np.testing.assert_allclose(
+            actual, aero_state.mixing_state(exclude=["H2O"], group=group)
+        )
+
+    @staticmethod
+    def test_mixing_state_unknown_group_species(aero_state):
+        # arrange
+        aero_data, aero_state = aero_state
+        sut = ppmc.SpeciesSelector(aero_data)
+
+        # act
+        with pytest.raises(RuntimeError) as excinfo:
+            aero_state.mixing_state(sut, group=["kopytko"])
+
+        # assert
+        assert str(excinfo.value) == "Element not found."
+
+    @staticmethod
+    def test_different_aero_data(aero_state):
+        # arrange
+        _, aero_state = aero_state
+        sut = ppmc.SpeciesSelector(ppmc.AeroData(AERO_DATA_CTOR_ARG_FULL))
+
+        # act
+        with pytest.raises(ValueError) as excinfo:
+            aero_state.masses(sut)
+
+        # assert
+        assert str(excinfo.value) == "SpeciesSelector built for a different AeroData"